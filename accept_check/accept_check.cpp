@@ -0,0 +1,138 @@
+/** ****************************************************************************
+ * \file
+ * \brief compares the acceptance rate of simulated_anealing with the exact
+ * exp(-E_diff / T) at low temperatures
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0
+ ******************************************************************************/
+
+#include <siquan/algo/algo.hpp>
+#include <siquan/base.hpp>
+#include <siquan/connect/connect.hpp>
+#include <siquan/scheduler/scheduler.hpp>
+#include <siquan/state/simple.hpp>
+#include <siquan/types/types.hpp>
+
+#include <fsc/ArgParser.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+
+/// \brief a single spin in the field \p field instead of a problem file
+template <typename super>
+class single_field : public super {
+    using s_param = typename super::param;
+
+public:
+    using typename super::weight_type;
+
+    struct param : public s_param {
+        weight_type field;
+    };
+
+    single_field(param const& p) : super(p), field_(p.field) {}
+
+    void init() {
+        super::init();
+        super::prot_n_vert() = 1;
+        super::prot_n_edge() = 1;
+        super::prot_get_itou()[0] = 0;
+        typename super::connect_type iact;
+        iact.weight = field_;
+        iact.vert_vec.push_back(0);
+        super::prot_get_connect().push_back(iact);
+    }
+
+private:
+    weight_type field_;
+};
+
+struct type_carrier {
+    // connect
+    using user_type = uint32_t;
+    using vert_type = uint32_t;
+
+    using weight_type = double;
+    using constr_type = double;
+
+    using size_type = size_t;
+    using vert_vec_type = std::vector<vert_type>;
+
+    using connect_type =
+        siquan::types::connect_type<weight_type, vert_vec_type>;
+    using connect_vec_type = std::vector<connect_type>;
+
+    // state
+    using state_type = std::vector<bool>;
+
+    // scheduler
+    using temp_type = double;
+};
+using grid_type =
+    compose<type_carrier, connect::basic, single_field, scheduler::sim_step,
+            scheduler::piecewise_multi_T, state::simple,
+            algo::simulated_anealing>;
+}  // end namespace siquan
+
+using namespace siquan;
+
+int main(int argc, char* argv[]) {
+    fsc::ArgParserTpl<std::string> ap(argc, argv);
+
+    ap.def("seed", "0");
+    ap.def("steps", "400000");
+
+    bool ok = true;
+    std::cout << "T field accept_bins exact measured" << std::endl;
+    for(std::string const T : {"0.001", "0.0005", "0.0001", "0.00001"}) {
+        for(double const ratio : {0.3, 1.0, 2.5}) {
+            for(std::string const bins : {"1", "1024"}) {
+                std::map<std::string, std::string> m = ap.n_args();
+                m["T"] = "[" + T + "," + T + "]";
+                m["accept_bins"] = bins;
+
+                grid_type::param p;
+                p.from_map(m);
+                p.field = ratio * std::stod(T);
+
+                grid_type g(p);
+                g.init();
+
+                // the spin is low at 1, see analyze_energy, and a flip from
+                // there costs E_diff = field
+                double attempts = 0;
+                double accepted = 0;
+                g.update();
+                while(not g.stop()) {
+                    bool const low = g.get_state()[0];
+                    g.step();
+                    if(low) {
+                        ++attempts;
+                        accepted += not g.get_state()[0];
+                    }
+                    g.advance(1);
+                    g.update();
+                }
+
+                double const exact = std::exp(-ratio);
+                double const measured = accepted / attempts;
+                double const sigma =
+                    std::sqrt(exact * (1 - exact) / attempts);
+                std::cout << T << " " << p.field << " " << bins << " "
+                          << exact << " " << measured << std::endl;
+                if(std::abs(measured - exact) > 5 * sigma) ok = false;
+            }
+        }
+    }
+    std::cout << (ok ? "passed" : "FAILED") << std::endl;
+
+    return ok ? 0 : 1;
+}
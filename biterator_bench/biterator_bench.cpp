@@ -0,0 +1,95 @@
+/** ****************************************************************************
+ * \file
+ * \brief times the set bit iteration of a trotter line for a growing popcount
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0
+ ******************************************************************************/
+
+#include <siquan/types/trotter_line.hpp>
+#include <siquan/types/trotter_matrix.hpp>
+
+#include <fsc/ArgParser.hpp>
+#include <fsc/profiler.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace siquan;
+
+/// \brief Sets \p pop distinct random slices of a line with \p nt slices
+template <typename L, typename G>
+L random_line(uint32_t const& nt, uint32_t const& pop, G& gen) {
+    std::vector<uint32_t> slices(nt);
+    std::iota(slices.begin(), slices.end(), 0);
+    std::shuffle(slices.begin(), slices.end(), gen);
+
+    L line(nt);
+    line.reset();
+    for(uint32_t i = 0; i < pop; ++i) line.flip(slices[i]);
+    return line;
+}
+
+/// \brief Cycles per pass over the set bits, via the Biterator
+template <typename L>
+double time_biterator(L const& line, uint32_t const& reps, uint64_t& sink) {
+    fsc::rdtsc_timer t;
+    t.start();
+    for(uint32_t r = 0; r < reps; ++r)
+        for(auto const& ts : line) sink += ts;
+    t.stop();
+    return t.cycles() / reps;
+}
+
+/// \brief Cycles per pass that tests every slice, as a reference
+template <typename L>
+double time_scan(L const& line, uint32_t const& reps, uint64_t& sink) {
+    fsc::rdtsc_timer t;
+    t.start();
+    for(uint32_t r = 0; r < reps; ++r)
+        for(uint32_t ts = 0; ts < line.size(); ++ts)
+            if(line[ts]) sink += ts;
+    t.stop();
+    return t.cycles() / reps;
+}
+
+int main(int argc, char* argv[]) {
+    fsc::ArgParserTpl<std::string> ap(argc, argv);
+
+    ap.def("nt", 4096);
+    ap.def("reps", 2000);
+    ap.def("seed", 0);
+
+    auto const& args = ap.n_args();
+    uint32_t const nt = std::stoul(args.at("nt"));
+    uint32_t const reps = std::stoul(args.at("reps"));
+    std::mt19937 gen(std::stoul(args.at("seed")));
+
+    // the sink keeps the compiler from dropping the loops
+    uint64_t sink = 0;
+
+    std::cout << "nt " << nt << std::endl;
+    std::cout << "popcount biterator_cycles cycles_per_bit word_cycles "
+                 "word_cycles_per_bit scan_cycles"
+              << std::endl;
+    for(uint32_t pop = 1;; pop = std::min(2 * pop, nt)) {
+        auto line = random_line<types::DynamicTrotterLine>(nt, pop, gen);
+        auto word = random_line<types::WordTrotterLine>(nt, pop, gen);
+        double bit = time_biterator(line, reps, sink);
+        double wbit = time_biterator(word, reps, sink);
+        double scan = time_scan(line, reps, sink);
+        std::cout << pop << " " << bit << " " << bit / pop << " " << wbit
+                  << " " << wbit / pop << " " << scan << std::endl;
+        if(pop == nt) break;
+    }
+    std::cout << "sink " << sink << std::endl;
+
+    return 0;
+}
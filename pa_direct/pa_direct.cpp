@@ -0,0 +1,138 @@
+/** ****************************************************************************
+ * \file
+ * \brief population annealing of simulated quantum annealing replicas, that
+ * share the problem
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0
+ ******************************************************************************/
+
+#include <siquan/algo/algo.hpp>
+#include <siquan/base.hpp>
+#include <siquan/connect/connect.hpp>
+#include <siquan/helper.hpp>
+#include <siquan/scheduler/scheduler.hpp>
+#include <siquan/state/simple.hpp>
+#include <siquan/state/trotter.hpp>
+#include <siquan/tools/engines.hpp>
+#include <siquan/types/types.hpp>
+
+#include <fsc/ArgParser.hpp>
+#include <fsc/profiler.hpp>
+
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+
+struct type_carrier {
+    // connect
+    using user_type = uint32_t;
+    using vert_type = uint32_t;
+
+    using weight_type = double;
+    using constr_type = double;
+
+    using size_type = size_t;
+    using vert_vec_type = std::vector<vert_type>;
+
+    using connect_type =
+        siquan::types::connect_type<weight_type, vert_vec_type>;
+    using connect_vec_type = std::vector<connect_type>;
+
+    // state
+    using state_type = siquan::types::TrotterMatrix;
+    using energy_type = double;  // or float, int32_t (fixed point)
+
+    // scheduler
+    using temp_type = double;
+    using magn_type = double;
+
+    // random
+    using rng_type = util::xoshiro256ss;
+};
+// reads and preprocesses the problem once
+using problem_grid_type =
+    compose<type_carrier, connect::basic, connect::read_in_txt, connect::remap,
+            connect::merge_equal>;
+// one replica of the population, the connections are shared between all of
+// them
+using grid_type =
+    compose<type_carrier, connect::shared,
+
+            scheduler::sim_step, scheduler::piecewise_multi_T,
+            scheduler::piecewise_multi_H,
+
+            state::trotter,
+
+            connect::normalize_weight, algo::simulated_quantum_anealing,
+            connect::unnormalize_weight, algo::analyze_energy_trotter,
+            algo::best_trotter,
+
+            algo::analyze_energy,
+
+            connect::unmap>;
+}  // end namespace siquan
+
+using namespace siquan;
+
+int main(int argc, char* argv[]) {
+    fsc::ArgParserTpl<std::string> ap(argc, argv);
+
+    problem_grid_type::param pp;
+    algo::population_annealing<grid_type>::param p;
+
+    std::map<std::string, std::string> m;
+
+    // set some defaults if we don't want to feed cmd args
+    ap.def("file", ap.get(0, "../test/data/frust.txt"));
+    ap.def("seed", "0");
+    ap.def("steps", "1000");
+    ap.def("remap", "sorted,fill,0");
+    ap.def("T", "[0.01,0.01]");
+    ap.def("H", "[10,iF,0.01]");
+    ap.def("nt", "100");
+    ap.def("population", "100");
+    ap.def("replica_threads",
+           std::to_string(std::thread::hardware_concurrency()));
+
+    pp.from_map(ap.n_args());
+    p.from_map(ap.n_args());
+
+    fsc::rdtsc_timer t;
+    t.start();
+
+    problem_grid_type pg(pp);
+    pg.init();
+    auto const problem = grid_type::extract(pg);
+    p.replica.problem = problem;
+
+    algo::population_annealing<grid_type> g(p);
+
+    g.init();
+
+    g.update();
+    while(not g.stop()) {
+        g.step();
+        g.advance(1);
+        g.update();
+    }
+    g.finish();
+
+    t.stop();
+
+    pp.to_map(m);
+    p.to_map(m);
+    siquan::to_map(m, t);
+    g.to_map(m);
+
+    for(auto const& a : m) {
+        std::cout << a.first << " " << a.second << std::endl;
+    }
+
+    return 0;
+}
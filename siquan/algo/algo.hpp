@@ -31,8 +31,15 @@ namespace algo {}
 }  // namespace siquan
 
 #include "analyze_energy.hpp"
+#include "best_ever_trotter.hpp"
+#include "best_replica.hpp"
 #include "best_trotter.hpp"
 #include "brute_force.hpp"
+#include "continuous_quantum_anealing.hpp"
+#include "parallel_tempering.hpp"
+#include "population_annealing.hpp"
+#include "rejection_free_anealing.hpp"
+#include "replica_quantum_anealing.hpp"
 #include "simulated_anealing.hpp"
 #include "simulated_quantum_anealing.hpp"
 
@@ -0,0 +1,206 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief Keeps the best slice visited during the annealing, not only the best
+ * one at the end
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_BEST_EVER_TROTTER_HPP_GUARD
+#define SIQUAN_ALGO_BEST_EVER_TROTTER_HPP_GUARD
+
+#include "../tools/serialize.hpp"
+#include "simulated_quantum_anealing.hpp"
+
+#include <fsc/stdSupport.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+
+    /// \brief Snapshots the slice with the lowest energy seen after any
+    /// update
+    /// \details Reads the slice energies the algorithm tracks (see
+    /// simulated_quantum_anealing::slice_energies()), i.e. a check costs
+    /// O(nt) and a snapshot O(n_vert), which is only taken if a slice beats
+    /// the best one so far by more than 1e-9 times the sum of the absolute
+    /// weights. The check runs every \p best_every updates and after the
+    /// last one. Use it between analyze_energy_trotter and best_trotter, s.t.
+    /// get_state() is the trotter state.
+    /// \tparam super is the parent module which needs to provide the types
+    /// \p size_type and \p weight_type and slice_energies()
+    template <typename super>
+    class best_ever_trotter : public super {
+        using s_param = typename super::param;
+
+    public:
+        /*==using declarations===*/
+        using typename super::size_type;
+        using typename super::weight_type;
+        using state_type = std::vector<bool>;  ///< the type for the best state
+
+        /// \brief param stage for this module
+        struct param : public s_param {
+            uint32_t best_every;  ///< updates between two checks
+
+            /// \brief dumps \p best_every to \p "best_every" in the map \p m
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void to_map(M &m) const {
+                s_param::to_map(m);
+                m["best_every"] = std::to_string(best_every);
+            }
+            /// \brief loads "best_every" from the map \p m into
+            /// \p best_every
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void from_map(M const &m) {
+                s_param::from_map(m);
+                best_every =
+                    fsc::sto<uint32_t>(fsc::get(m, "best_every", "1"));
+            }
+        };
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructor argument for super
+        best_ever_trotter(param const &p)
+            : super(p),
+              every_(std::max(p.best_every, uint32_t(1))),
+              updates_(0),
+              tol_(0),
+              tracked_(std::numeric_limits<double>::infinity()),
+              energy_(0),
+              step_(0) {}
+        /*===modifying methods===*/
+        /// \brief initializes super and then forgets the best slice
+        void init() {
+            super::init();
+            double abs_sum = 0;
+            for(auto const &iact : super::get_connect())
+                abs_sum += std::abs(iact.weight);
+            tol_ = 1e-9 * abs_sum;
+            updates_ = 0;
+            tracked_ = std::numeric_limits<double>::infinity();
+            state_.clear();
+        }
+        /// \brief updates super and then checks the slices every
+        /// \p best_every updates
+        void update() {
+            super::update();
+            if(updates_ % every_ == 0) check_(updates_);
+            ++updates_;
+        }
+        /// \brief writes the super and then the best slice so far to \p s
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, updates_);
+            util::write(s, tracked_);
+            util::write(s, step_);
+            util::write(s, state_);
+        }
+        /// \brief reads the super and then the best slice so far from \p s
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            util::read(s, updates_);
+            util::read(s, tracked_);
+            util::read(s, step_);
+            util::read(s, state_);
+        }
+        /// \brief finishes super, checks the last state and calculates the
+        /// exact energy of the best slice
+        void finish() {
+            super::finish();
+            if(updates_ > 0) check_(updates_ - 1);
+
+            auto const &con = super::get_connect();
+            energy_ = 0;
+            for(auto const &iact : con) {
+                bool allingment = false;
+                for(auto const &s : iact.vert_vec)
+                    allingment ^= not state_[s];
+                energy_ +=
+                    get_interaction_contribution(allingment, iact.weight);
+            }
+        }
+        /*==== const methods ====*/
+        /// \brief get the best slice seen so far (true for spin up)
+        state_type const &get_best_ever_state() const { return state_; }
+        /// \brief get the energy of get_best_ever_state()
+        /// \pre finish() was called
+        weight_type const &best_ever_energy() const { return energy_; }
+        /// \brief get the amount of steps before the best slice was seen,
+        /// i.e. 0 for the initial state
+        size_type const &best_ever_step() const { return step_; }
+
+        /// \brief dumps \p best_ever_energy to \p "best_ever_energy",
+        /// \p best_ever_step to \p "best_ever_step" and the up spins of the
+        /// best slice in the labels of the input to \p "best_ever_state"
+        /// in the map \p m (like connect::unmap)
+        /// \param m \p std::map<std::string, std::string> like instance.
+        template <typename M>
+        void to_map(M &m) const {
+            super::to_map(m);
+            std::vector<typename super::user_type> up;
+            for(size_type i = 0; i < state_.size(); ++i)
+                if(state_[i]) up.push_back(super::get_itou().at(i));
+            std::sort(up.begin(), up.end());
+            m["best_ever_energy"] = std::to_string(best_ever_energy());
+            m["best_ever_step"] = std::to_string(best_ever_step());
+            m["best_ever_state"] = fsc::to_string(up);
+        }
+
+    private:
+        // snapshots the best slice if it beats the best one so far
+        void check_(size_type const &step) {
+            auto const ener = super::slice_energies();
+            auto const best = std::min_element(ener.begin(), ener.end());
+            if(not(*best < tracked_ - tol_)) return;
+
+            tracked_ = *best;
+            step_ = step;
+            size_type const ts = best - ener.begin();
+            auto const &lat = super::get_state();
+            state_.resize(super::n_vert());
+            for(size_type i = 0; i < super::n_vert(); ++i)
+                state_[i] = (lat[i][ts] == super::spin_up());
+        }
+
+    private:
+        uint32_t const every_;
+        size_type updates_;
+        double tol_;
+        double tracked_;  // slice energy of state_ as tracked by super
+        weight_type energy_;
+        size_type step_;
+        state_type state_;
+    };
+
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_BEST_EVER_TROTTER_HPP_GUARD
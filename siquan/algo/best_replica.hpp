@@ -0,0 +1,154 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief Analyzes the energies of all replicas and selects the best one
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_BEST_REPLICA_HPP_GUARD
+#define SIQUAN_ALGO_BEST_REPLICA_HPP_GUARD
+
+#include "simd.hpp"
+
+#include <fsc/stdSupport.hpp>
+
+#include "../types/aligned_allocator.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+
+    /// \brief Selects the best trotter slice of every replica and the best
+    /// replica of a multi spin coded state
+    /// \tparam super is the parent module which needs to provide the types
+    /// \p size_type, \p state_type (<tt>std::vector<types::ReplicaLine<W>>
+    /// </tt>) and \p weight_type
+    template <typename super>
+    class best_replica : public super {
+        // spin up follows the convention of simulated_quantum_anealing
+        using s_param = typename super::param;
+        using replica_line_type = typename super::state_type::value_type;
+
+    public:
+        /*==using declarations===*/
+        using typename super::size_type;
+        using typename super::weight_type;
+        using state_type = std::vector<bool>;  ///< the type for the best state
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructor argument for super
+        best_replica(s_param const &p)
+            : super(p), min_replica_(0), degen_(0) {}
+        /*===modifying methods===*/
+        /*==== const methods ====*/
+        /// \brief get the state of the best slice of the best replica
+        state_type const &get_state() const { return state_; }
+        /// \brief get the state of the best slice of replica \p r
+        state_type get_replica_state(size_type const &r) const {
+            state_type res(super::n_vert());
+            auto const &lat = super::get_state();
+            for(size_type i = 0; i < super::n_vert(); ++i)
+                res[i] = (((lat[i][slice_[r]] >> r) & 1) ==
+                          uint64_t(super::spin_up()));
+            return res;
+        }
+        /// \brief get the energy of the best slice of every replica
+        std::vector<weight_type> const &replica_energy() const {
+            return ener_;
+        }
+        /// \brief get the index of the best slice of every replica
+        std::vector<size_type> const &replica_slice() const { return slice_; }
+        /// \brief get the index of the first replica with minimal energy
+        size_type const &min_replica() const { return min_replica_; }
+        /// \brief get the amount of replicas with minimal energy
+        size_type const &replica_degen() const { return degen_; }
+
+        /// \brief dumps \p min_replica to \p "min_replica", \p replica_degen
+        /// to \p "replica_degen" and \p replica_energy to
+        /// \p "replica_energy" in the map \p m
+        /// \param m \p std::map<std::string, std::string> like instance.
+        template <typename M>
+        void to_map(M &m) const {
+            super::to_map(m);
+            m["min_replica"] = std::to_string(min_replica());
+            m["replica_degen"] = std::to_string(replica_degen());
+            m["replica_energy"] = fsc::to_string(replica_energy());
+        }
+
+    protected:
+        /// \brief calls super::calc and then selects the best slice of every
+        /// replica and the best replica
+        void calc() {
+            super::calc();
+
+            auto const n = replica_line_type::n_replica;
+            auto const &lat = super::get_state();
+            auto const &con = super::get_connect();
+
+            ener_.assign(n, std::numeric_limits<weight_type>::max());
+            slice_.assign(n, 0);
+
+            // energy of one slice for all replicas at once
+            std::vector<weight_type, types::aligned_allocator<weight_type>> e(
+                n);
+            for(size_type ts = 0; ts < super::get_nt(); ++ts) {
+                std::fill(e.begin(), e.end(), weight_type(0));
+                for(auto const &iact : con) {
+                    typename replica_line_type::value_type allingment = 0;
+                    for(auto const &s : iact.vert_vec) allingment ^= lat[s][ts];
+                    // + weight for set bits, see get_interaction_contribution
+                    simd::add_signed(e.data(), allingment, -iact.weight, n);
+                }
+                for(size_type r = 0; r < n; ++r) {
+                    if(e[r] < ener_[r]) {
+                        ener_[r] = e[r];
+                        slice_[r] = ts;
+                    }
+                }
+            }
+
+            // find degen and min_replica
+            min_replica_ = 0;
+            degen_ = 1;
+            for(size_type r = 1; r < n; ++r) {
+                if(ener_[r] < ener_[min_replica_]) {
+                    min_replica_ = r;
+                    degen_ = 1;
+                } else if(ener_[r] == ener_[min_replica_])
+                    ++degen_;
+            }
+            state_ = get_replica_state(min_replica_);
+        }
+
+    private:
+        std::vector<weight_type> ener_;
+        std::vector<size_type> slice_;
+        size_type min_replica_;
+        size_type degen_;
+        state_type state_;
+    };
+
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_BEST_REPLICA_HPP_GUARD
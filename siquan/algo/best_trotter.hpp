@@ -29,8 +29,12 @@
 
 #include <fsc/stdSupport.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <map>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace siquan {  // documented in base.hpp
@@ -48,7 +52,26 @@ T &operator^=(T &lhs, std::vector<bool> const &rhs) {
 
 namespace algo {  // documented in algo.hpp
 
+    /// \cond IMPLEMENTATION_DETAIL_DOC
+    namespace detail {
+        // true if T tracks the energies of its slices during the updates
+        // (simulated_quantum_anealing), the totals then cost O(nt)
+        template <typename T, typename = void>
+        struct tracks_slices : std::false_type {};
+        template <typename T>
+        struct tracks_slices<T, decltype(void(std::declval<T const &>()
+                                                  .slice_energies()))>
+            : std::true_type {};
+    }  // end namespace detail
+    /// \endcond
+
     /// \brief Functionality to measure broken constraints
+    /// \details The total energies of the slices are read from the algorithm
+    /// if it tracks them (O(nt)) and recomputed (O(nt * n_edge)) otherwise.
+    /// Only the slice min_index() is split up by the order of the
+    /// interactions, its total is exact. Slices within 1e-9 times the sum of
+    /// the absolute weights count as degenerate, s.t. the rounding of the
+    /// tracked totals does not matter.
     /// \tparam super is the parent module which needs to provide the types
     /// \p size_type, \p state_type and \p weight_type
     template <typename super>
@@ -68,19 +91,12 @@ namespace algo {  // documented in algo.hpp
         analyze_energy_trotter(s_param const &p) : super(p) {}
         /*===modifying methods===*/
         /*==== const methods ====*/
-        /// \brief get the energy distributions of all trotter slices
-        std::vector<std::map<size_type, weight_type>> const &get_energy_distr()
-            const {
-            return ener_;
+        /// \brief get the energy distribution of the slice min_index()
+        std::map<size_type, weight_type> const &get_energy_distr() const {
+            return distr_;
         }
         /// \brief get the total energy of all trotter slices
-        std::vector<weight_type> const get_energy() const {
-            std::vector<weight_type> res;
-            for(auto const &a : get_energy_distr()) {
-                res.push_back(a.at(0));
-            }
-            return res;
-        }
+        std::vector<weight_type> const &get_energy() const { return energy_; }
         /// \brief return the absolute sum of all interactions
         weight_type const &weight_sum() const { return weight_sum_; }
         /// \brief get the index of the first trotter slice with minimal energy
@@ -108,52 +124,83 @@ namespace algo {  // documented in algo.hpp
         void calc() {
             super::calc();
 
-            // calc all energies
-            ener_.resize(super::get_nt());
+            weight_sum_ = 0;
+            double abs_sum = 0;
+            for(auto const &iact : super::get_connect()) {
+                weight_sum_ += iact.weight;
+                abs_sum += std::abs(iact.weight);
+            }
+            tol_ = 1e-9 * abs_sum;
+
+            slice_energies_(detail::tracks_slices<super>());
+            select_();
+            // the tracked totals hold for the state connections of the
+            // algorithm, recompute if they differ from the connections here
+            // (more than the rounding of a fixed point energy_type)
+            if(std::abs(energy_[min_index_] - distr_.at(0)) > 1e6 * tol_) {
+                slice_energies_(std::false_type());
+                select_();
+            }
+            energy_[min_index_] = distr_.at(0);
+        }
+
+    private:
+        // finds degen and min_index and splits the slice min_index by order
+        void select_() {
             auto const &lat = super::get_state();
             auto const &con = super::get_connect();
 
-            typename state_type::value_type allingment(super::get_nt());
+            weight_type const energy =
+                *std::min_element(energy_.begin(), energy_.end());
+            min_index_ = super::get_nt();
+            degen_ = 0;
+            for(size_type ts = 0; ts < super::get_nt(); ++ts) {
+                if(energy_[ts] <= energy + tol_) {
+                    if(degen_++ == 0) min_index_ = ts;
+                }
+            }
 
-            // set total energy (i.e. size = 0) to 0, since there may be no
-            // connections
-            for(size_t ts = 0; ts < super::get_nt(); ++ts) ener_[ts][0] = 0;
+            distr_.clear();
+            distr_[0] = 0;  // there may be no connections
+            for(auto const &iact : con) {
+                bool allingment = false;
+                for(auto const &s : iact.vert_vec)
+                    allingment ^= lat[s][min_index_];
+                auto epart =
+                    get_interaction_contribution(allingment, iact.weight);
+                distr_[iact.vert_vec.size()] += epart;
+                distr_[0] += epart;
+            }
+        }
+        // totals tracked by the algorithm
+        void slice_energies_(std::true_type) {
+            auto const totals = super::slice_energies();
+            energy_.assign(totals.begin(), totals.end());
+        }
+        // recomputes the totals from all connections
+        void slice_energies_(std::false_type) {
+            auto const &lat = super::get_state();
+            auto const &con = super::get_connect();
 
-            weight_sum_ = 0;
-            for(size_type i = 0; i < con.size(); ++i) {
-                auto const &iact = con[i];
-                auto const size = iact.vert_vec.size();
-                weight_sum_ += iact.weight;
+            typename state_type::value_type allingment(super::get_nt());
 
+            energy_.assign(super::get_nt(), 0);
+            for(auto const &iact : con) {
                 allingment.reset();
 
                 for(auto const &s : iact.vert_vec) allingment ^= lat[s];
 
-                for(size_t ts = 0; ts < super::get_nt(); ++ts) {
-                    auto epart = get_interaction_contribution(allingment[ts],
-                                                              iact.weight);
-                    ener_[ts][size] += epart;  // TODO: maybe add option
-                    ener_[ts][0] += epart;
-                }
-            }
-
-            // find degen and min_index
-            min_index_ = 0;
-            degen_ = 1;
-            weight_type energy = ener_[0].at(0);
-            for(size_type ts = 1; ts < super::get_nt(); ++ts) {
-                if(ener_[ts].at(0) < energy) {
-                    min_index_ = ts;
-                    energy = ener_[ts].at(0);
-                    degen_ = 1;
-                } else if(ener_[ts].at(0) == energy)
-                    ++degen_;
+                for(size_t ts = 0; ts < super::get_nt(); ++ts)
+                    energy_[ts] += get_interaction_contribution(allingment[ts],
+                                                                iact.weight);
             }
         }
 
     private:
-        std::vector<std::map<size_type, weight_type>> ener_;
+        std::vector<weight_type> energy_;         // total of every slice
+        std::map<size_type, weight_type> distr_;  // of the slice min_index_
         weight_type weight_sum_;
+        weight_type tol_;  // of degenerate slices
         size_type degen_;
         size_type min_index_;
     };
@@ -179,17 +226,14 @@ namespace algo {  // documented in algo.hpp
         /// \brief get the state of the best trotter state
         state_type const &get_state() const { return state_; }
 
-        /// \brief get the energy distribution of the best state
-        std::map<size_type, weight_type> const &get_energy_distr() const {
-            return super::get_energy_distr()[super::min_index()];
-        }
-        /// \brief dumps \p state to \p "state" and
-        /// \p energy_distr to \p "energy_distr" and in the map \p m
+        /// \brief dumps \p state to \p "state" and the energy distribution
+        /// of the best state (see analyze_energy_trotter::get_energy_distr())
+        /// to \p "energy_distr" and in the map \p m
         /// \param m \p std::map<std::string, std::string> like instance.
         template <typename M>
         void to_map(M &m) const {
             super::to_map(m);
-            m["energy_distr"] = fsc::to_string(get_energy_distr());
+            m["energy_distr"] = fsc::to_string(super::get_energy_distr());
             m["state"] = fsc::to_string(get_state());
         }
 
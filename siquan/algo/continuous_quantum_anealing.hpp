@@ -0,0 +1,319 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief simulated quantum annealing in continuous imaginary time, i.e. the
+ * limit nt -> infinity of simulated_quantum_anealing
+ * \details The world-line of every spin is a sorted list of kink times in
+ * [0, 1) (in units of beta) and the spin at time 0. A sweep places cuts with
+ * rate beta * |H| on every world-line, the kinks and cuts split it into
+ * clusters, which are flipped like the clusters of the discrete algorithm.
+ * The cost of a sweep scales with the amount of kinks and cuts, not with nt.
+ * The world-lines are periodic in imaginary time.
+ *
+ * The state of the super (\p nt slices) is only a projection of the
+ * world-lines to the times <tt>(ts + 0.5) / nt</tt>, that is written in
+ * init() and calc(), s.t. the finalizers of the discrete algorithm work as
+ * before.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_CONTINUOUS_QUANTUM_ANEALING_HPP_GUARD
+#define SIQUAN_ALGO_CONTINUOUS_QUANTUM_ANEALING_HPP_GUARD
+
+#include "legacy/fastmath.hpp"
+#include "simulated_quantum_anealing.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+
+    /// \brief This module provides a simulated quantum annealing
+    /// implementation in continuous imaginary time
+    /// \tparam super is the parent module which needs to provide the types
+    /// \p state_type, \p size_type, \p connect_type and \p rng_type
+    template <typename super>
+    class continuous_quantum_anealing : public super {
+        using s_param = typename super::param;
+        using rng_type = typename super::rng_type;
+        using connect_type = typename super::connect_type;
+
+    public:
+        /*==using declarations===*/
+        using typename super::state_type;
+        using typename super::size_type;
+        using param = s_param;  ///< no own parameters
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructor argument for super and seeds own RNGs
+        continuous_quantum_anealing(param const &p)
+            : super(p), NT(super::get_nt()), drand(0, 1), beta_(0), rate_(0) {
+            rnd_generator.seed(p.seed_rng());
+        }
+        /*===modifying methods===*/
+        /// \brief initializes super and then the module
+        /// \details every world-line starts without kinks in a random state,
+        /// the interactions are split per spin into the weight and the other
+        /// spins (an even multiplicity cancels)
+        void init() {
+            super::init();
+
+            auto const &con = super::get_state_connect();
+            size_type const n = super::n_vert();
+
+            kinks_.assign(n, std::vector<double>());
+            spin0_.assign(n, 0);
+            terms_.assign(n, std::vector<term_type>());
+            for(uint32_t idx = 0; idx < n; ++idx) {
+                spin0_[idx] = rnd_generator() & 1;
+                for(size_type c = 0; c < con[idx].size(); ++c) {
+                    auto const &iptr = con[idx][c];
+                    // state_connect lists an interaction once per vertex
+                    if(std::find(con[idx].begin(), con[idx].begin() + c,
+                                 iptr) != con[idx].begin() + c)
+                        continue;
+                    std::vector<uint32_t> odd;
+                    for(auto const &nb : iptr->vert_vec) {
+                        auto it = std::find(odd.begin(), odd.end(), nb);
+                        if(it == odd.end())
+                            odd.push_back(nb);
+                        else
+                            odd.erase(it);
+                    }
+                    auto it = std::find(odd.begin(), odd.end(), idx);
+                    if(it == odd.end()) continue;  // constant for idx
+                    odd.erase(it);
+                    terms_[idx].push_back({iptr, std::move(odd)});
+                }
+            }
+            project_();
+        }
+
+        /// \brief advances the state of the super and then the module's state
+        /// \details attempts to do cluster updates over all world-lines
+        void step() {
+            super::step();
+            for(uint32_t idx = 0; idx < super::n_vert(); ++idx)
+                update_line_(idx);
+        }
+
+        /// \brief updates the super and gets the new state of the schedulers
+        void update() {
+            super::update();
+            beta_ = 1 / super::temperature();
+            // the cluster energies are integrals over [0, 1) in units of beta
+            fexp.set_coefficient(2 * beta_);
+            rate_ = beta_ * std::abs(super::transverse_field());
+        }
+        /*==== const methods ====*/
+        /// \brief what we refer to a up spin
+        int spin_up() const { return 0; }
+        /// \brief get the total amount of kinks of all world-lines
+        size_type n_kinks() const {
+            size_type res = 0;
+            for(auto const &k : kinks_) res += k.size();
+            return res;
+        }
+        /// \brief get the kink times of spin \p i in units of beta
+        std::vector<double> const &get_kinks(size_type const &i) const {
+            return kinks_[i];
+        }
+
+        /// \brief dumps \p n_kinks to \p "kinks" in the map \p m
+        /// \param m \p std::map<std::string, std::string> like instance.
+        template <typename M>
+        void to_map(M &m) const {
+            super::to_map(m);
+            m["kinks"] = std::to_string(n_kinks());
+        }
+
+        /// \brief print information about super, then of the own module
+        void print() {
+            super::print();
+            std::cout << "Continuous Quantum Annealing: " << n_kinks()
+                      << " kinks" << std::endl;
+        }
+
+    protected:
+        /// \brief projects the world-lines to the slices of the state and then
+        /// calls super::calc
+        void calc() {
+            project_();
+            super::calc();
+        }
+
+    private:
+        // interaction of one spin without its own sign, the weight is read
+        // at every sweep in case it is scheduled
+        struct term_type {
+            connect_type const *iptr;
+            std::vector<uint32_t> others;
+        };
+        // the sign of a term changes at time
+        struct event_type {
+            double time;
+            uint32_t term;
+        };
+        // cluster boundary, either a kink or a cut
+        struct break_type {
+            double time;
+            bool kink;
+        };
+
+        // one cluster update of world-line idx
+        void update_line_(uint32_t const &idx) {
+            auto const &terms = terms_[idx];
+            auto &kinks = kinks_[idx];
+
+            // field of the other spins, g(u), as a start value and events
+            double g = 0;
+            contrib_.resize(terms.size());
+            events_.clear();
+            for(uint32_t t = 0; t < terms.size(); ++t) {
+                bool parity = false;
+                for(auto const &nb : terms[t].others) {
+                    parity ^= spin0_[nb];
+                    for(auto const &u : kinks_[nb]) events_.push_back({u, t});
+                }
+                contrib_[t] =
+                    get_interaction_contribution(parity, terms[t].iptr->weight);
+                g += contrib_[t];
+            }
+            std::sort(events_.begin(), events_.end(),
+                      [](auto const &a, auto const &b) {
+                          return a.time < b.time;
+                      });
+
+            // breaks: all kinks and Poisson distributed cuts
+            breaks_.clear();
+            auto k = kinks.begin();
+            double cut = next_cut_(0);
+            while(k != kinks.end() or cut < 1) {
+                if(k != kinks.end() and *k < cut)
+                    breaks_.push_back({*k++, true});
+                else {
+                    breaks_.push_back({cut, false});
+                    cut = next_cut_(cut);
+                }
+            }
+
+            // integral of g from 0 to every break and to 1
+            integral_.resize(breaks_.size() + 1);
+            double acc = 0;
+            double last = 0;
+            auto e = events_.begin();
+            for(size_type b = 0; b <= breaks_.size(); ++b) {
+                double const u = b < breaks_.size() ? breaks_[b].time : 1;
+                for(; e != events_.end() and e->time < u; ++e) {
+                    acc += g * (e->time - last);
+                    last = e->time;
+                    g -= 2 * contrib_[e->term];
+                    contrib_[e->term] = -contrib_[e->term];
+                }
+                acc += g * (u - last);
+                last = u;
+                integral_[b] = acc;
+            }
+
+            bool const s0 = spin0_[idx];
+            size_type const m = breaks_.size();
+            if(m == 0) {  // no break at all, the line is one cluster
+                if(accept_(s0 ? -acc : acc)) spin0_[idx] ^= 1;
+                return;
+            }
+            // the cluster b starts at break b, the last one wraps around
+            spins_.resize(m);
+            bool s = s0;
+            for(size_type b = 0; b < m; ++b) {
+                s ^= breaks_[b].kink;
+                double const en = b + 1 < m
+                                      ? integral_[b + 1] - integral_[b]
+                                      : integral_[m] - integral_[b] + integral_[0];
+                spins_[b] = s ^ accept_(s ? -en : en);
+            }
+            // new kinks where neighbouring clusters differ
+            kinks.clear();
+            bool prev = spins_[m - 1];
+            for(size_type b = 0; b < m; ++b) {
+                if(spins_[b] != prev) kinks.push_back(breaks_[b].time);
+                prev = spins_[b];
+            }
+            spin0_[idx] = spins_[m - 1];
+        }
+
+        // next cut after u, 1 or more if there is none in [u, 1)
+        double next_cut_(double const &u) {
+            if(rate_ == 0) return 1;
+            return u - std::log(1 - drand(rnd_generator)) / rate_;
+        }
+
+        // decides a cluster flip with the integral en of its local energy
+        bool accept_(double const &en) {
+            return en >= 0 or drand(rnd_generator) <= fexp(en);
+        }
+
+        // writes the spins at the times (ts + 0.5) / nt to the state
+        void project_() {
+            auto &lat = super::prot_get_state();
+            for(uint32_t idx = 0; idx < super::n_vert(); ++idx) {
+                auto const &k = kinks_[idx];
+                auto next = k.begin();
+                bool s = spin0_[idx];
+                size_type ts = 0;
+                lat[idx].generate([&]() {
+                    uint64_t word = 0;
+                    for(int b = 0; b < 64 and ts < NT; ++b, ++ts) {
+                        double const u = (ts + 0.5) / NT;
+                        for(; next != k.end() and *next <= u; ++next) s ^= 1;
+                        word |= uint64_t(s) << b;
+                    }
+                    return word;
+                });
+            }
+        }
+
+    private:
+        const uint32_t NT;
+        std::vector<std::vector<double>> kinks_;  // sorted, in units of beta
+        std::vector<char> spin0_;                 // spin at time 0
+        std::vector<std::vector<term_type>> terms_;
+        // scratch space of update_line_
+        std::vector<double> contrib_;
+        std::vector<event_type> events_;
+        std::vector<break_type> breaks_;
+        std::vector<double> integral_;
+        std::vector<char> spins_;
+
+        std::uniform_real_distribution<double> drand;
+        double beta_;
+        double rate_;  // cuts per world-line
+        fastmath::exp<true, 12> fexp;
+        mutable rng_type rnd_generator;
+    };
+
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_CONTINUOUS_QUANTUM_ANEALING_HPP_GUARD
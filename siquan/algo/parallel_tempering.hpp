@@ -0,0 +1,266 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief replica exchange (parallel tempering) of grids at a ladder of
+ * temperatures and/or transverse fields
+ * \details parallel_tempering is not a module, it drives K grids of the same
+ * type like a single one (init, update, step, advance, stop, finish, to_map).
+ * The grids step in parallel, afterwards neighbouring rungs of the ladder
+ * propose to exchange their configurations with the Metropolis ratio of
+ * G::exchange_log_ratio(), which the algorithms compute from their tracked
+ * energies (simulated_anealing, rejection_free_anealing,
+ * simulated_quantum_anealing). An accepted exchange swaps the buffers of the
+ * configurations with G::swap_state(), nothing is copied. The even and the
+ * odd pairs take turns.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_PARALLEL_TEMPERING_HPP_GUARD
+#define SIQUAN_ALGO_PARALLEL_TEMPERING_HPP_GUARD
+
+#include "../param.hpp"
+
+#include <fsc/stdSupport.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+
+    /// \brief Runs and exchanges the configurations of grids at different
+    /// temperatures and/or transverse fields
+    /// \tparam G is the grid type (a compose<...>), which needs to provide
+    /// the type \p size_type, exchange_log_ratio(), swap_state() and
+    /// energy() after finish() (e.g. analyze_energy)
+    template <typename G>
+    class parallel_tempering {
+    public:
+        /*==using declarations===*/
+        using grid_type = G;
+        using size_type = typename G::size_type;
+
+        /// \brief param stage, holds the params of all replicas
+        /// \details Replica k runs at the constant temperature
+        /// <tt>T_ladder[k]</tt> and/or transverse field <tt>H_ladder[k]</tt>,
+        /// the other one follows the usual schedule \p "T" or \p "H".
+        struct param : public seed_param {
+            std::vector<typename G::param> replica;  ///< one per rung
+            std::vector<double> T_ladder;  ///< temperatures, may be empty
+            std::vector<double> H_ladder;  ///< transverse fields, may be empty
+            uint32_t threads;              ///< threads that step the replicas
+            size_type swap_every;          ///< steps between two exchanges
+
+            /// \brief dumps the param of the first replica, \p T_ladder,
+            /// \p H_ladder, \p threads to \p "replica_threads" and
+            /// \p swap_every to the map \p m
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void to_map(M &m) const {
+                replica.front().to_map(m);
+                seed_param::to_map(m);
+                if(not T_ladder.empty()) {
+                    m["T_ladder"] = fsc::to_string(T_ladder);
+                    m.erase("T");
+                }
+                if(not H_ladder.empty()) {
+                    m["H_ladder"] = fsc::to_string(H_ladder);
+                    m.erase("H");
+                }
+                m["replica_threads"] = std::to_string(threads);
+                m["swap_every"] = std::to_string(swap_every);
+            }
+            /// \brief loads "T_ladder", "H_ladder", "replica_threads" and
+            /// "swap_every" from the map \p m and builds one param per rung
+            /// from \p m with the constant schedules of the ladders
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void from_map(M const &m) {
+                seed_param::from_map(m);
+                threads =
+                    fsc::sto<uint32_t>(fsc::get(m, "replica_threads", "1"));
+                swap_every =
+                    fsc::sto<size_type>(fsc::get(m, "swap_every", "1"));
+
+                auto ladder = [&m](std::string const &key) {
+                    std::string const in = fsc::get(m, key, "");
+                    return in.empty() ? std::vector<double>()
+                                      : fsc::sto<std::vector<double>>(in);
+                };
+                T_ladder = ladder("T_ladder");
+                H_ladder = ladder("H_ladder");
+                if(not T_ladder.empty() and not H_ladder.empty() and
+                   T_ladder.size() != H_ladder.size())
+                    throw std::runtime_error(
+                        "parallel_tempering: T_ladder and H_ladder need the "
+                        "same length");
+                auto const n = std::max(T_ladder.size(), H_ladder.size());
+                if(n == 0)
+                    throw std::runtime_error(
+                        "parallel_tempering: neither T_ladder nor H_ladder "
+                        "is set");
+
+                auto constant = [](double const &x) {
+                    std::stringstream ss;
+                    ss.precision(std::numeric_limits<double>::max_digits10);
+                    ss << "[" << x << "," << x << "]";
+                    return ss.str();
+                };
+                replica.assign(n, typename G::param());
+                for(size_type k = 0; k < n; ++k) {
+                    std::map<std::string, std::string> mk(m.begin(), m.end());
+                    if(not T_ladder.empty()) mk["T"] = constant(T_ladder[k]);
+                    if(not H_ladder.empty()) mk["H"] = constant(H_ladder[k]);
+                    replica[k].from_map(mk);
+                    replica[k].set_seed(static_cast<uint32_t>(seed_rng()));
+                }
+            }
+        };
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructs one grid per replica and seeds the own RNG
+        parallel_tempering(param const &p)
+            : threads_(std::max(p.threads, uint32_t(1))),
+              swap_every_(std::max(p.swap_every, size_type(1))),
+              steps_(0),
+              attempts_(p.replica.size() - 1, 0),
+              accepts_(p.replica.size() - 1, 0),
+              drand(0, 1) {
+            rnd_generator.seed(p.seed_rng());
+            for(auto const &rp : p.replica) replica_.emplace_back(rp);
+        }
+        /*===modifying methods===*/
+        /// \brief initializes all replicas
+        /// \details serial, since reading a problem is not thread safe
+        void init() {
+            for(auto &g : replica_) g.init();
+        }
+        /// \brief updates all replicas
+        void update() {
+            for(auto &g : replica_) g.update();
+        }
+        /// \brief advances all replicas in parallel and then proposes
+        /// exchanges every \p swap_every steps
+        void step() {
+            int const n = static_cast<int>(replica_.size());
+            int const n_threads = static_cast<int>(threads_);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1)
+#endif
+            for(int k = 0; k < n; ++k) replica_[k].step();
+            (void)n_threads;
+
+            ++steps_;
+            if(steps_ % swap_every_ == 0) exchange_((steps_ / swap_every_) % 2);
+        }
+        /// \brief advances the schedulers of all replicas
+        template <typename O>
+        void advance(O const &o) {
+            for(auto &g : replica_) g.advance(o);
+        }
+        /// \brief finishes all replicas
+        void finish() {
+            for(auto &g : replica_) g.finish();
+        }
+        /*==== const methods ====*/
+        /// \brief true if the replicas stop (they share the amount of steps)
+        bool stop() const { return replica_.front().stop(); }
+        /// \brief get the amount of replicas
+        size_type size() const { return replica_.size(); }
+        /// \brief get the replica \p k, i.e. rung \p k of the ladder
+        G const &operator[](size_type const &k) const { return replica_[k]; }
+        /// \brief get the accepted fraction of the exchanges between rung
+        /// \p k and \p k + 1 for all \p k
+        std::vector<double> swap_rates() const {
+            std::vector<double> res(attempts_.size(), 0);
+            for(size_type k = 0; k < res.size(); ++k)
+                if(attempts_[k] > 0) res[k] = double(accepts_[k]) / attempts_[k];
+            return res;
+        }
+        /// \brief get the replica with the lowest energy
+        /// \pre finish() was called
+        size_type best() const {
+            size_type res = 0;
+            for(size_type k = 1; k < replica_.size(); ++k)
+                if(replica_[k].energy() < replica_[res].energy()) res = k;
+            return res;
+        }
+
+        /// \brief dumps the best replica to the map \p m, as well as
+        /// \p best to \p "best_replica", the energies of all replicas to
+        /// \p "replica_energies" and \p swap_rates to \p "swap_rates"
+        /// \param m \p std::map<std::string, std::string> like instance.
+        /// \pre finish() was called
+        template <typename M>
+        void to_map(M &m) const {
+            replica_[best()].to_map(m);
+            std::vector<double> energies;
+            for(auto const &g : replica_) energies.push_back(g.energy());
+            m["best_replica"] = std::to_string(best());
+            m["replica_energies"] = fsc::to_string(energies);
+            m["swap_rates"] = fsc::to_string(swap_rates());
+        }
+        /// \brief print some information about the exchanges
+        void print() const {
+            std::cout << "Parallel Tempering: " << replica_.size()
+                      << " replicas" << std::endl;
+            std::cout << "swap rates: " << fsc::to_string(swap_rates())
+                      << std::endl;
+        }
+
+    private:
+        // Metropolis exchanges of the pairs (k, k + 1) with k % 2 == parity
+        void exchange_(size_type const &parity) {
+            for(size_type k = parity; k + 1 < replica_.size(); k += 2) {
+                ++attempts_[k];
+                double const r =
+                    replica_[k].exchange_log_ratio(replica_[k + 1]);
+                if(r >= 0 or drand(rnd_generator) < std::exp(r)) {
+                    replica_[k].swap_state(replica_[k + 1]);
+                    ++accepts_[k];
+                }
+            }
+        }
+
+    private:
+        uint32_t const threads_;
+        size_type const swap_every_;
+        size_type steps_;
+        std::deque<G> replica_;  // constructed in place, G needs no moves
+        std::vector<size_type> attempts_;  // per pair (k, k + 1)
+        std::vector<size_type> accepts_;
+        std::uniform_real_distribution<double> drand;
+        std::mt19937 rnd_generator;  // only for the exchanges
+    };
+
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_PARALLEL_TEMPERING_HPP_GUARD
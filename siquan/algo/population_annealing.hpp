@@ -0,0 +1,280 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief population annealing of many grids along the same schedule
+ * \details population_annealing is not a module, it drives R grids of the
+ * same type like a single one (init, update, step, advance, stop, finish,
+ * to_map). The grids step in parallel, every thread takes a fixed part of the
+ * population. Whenever the schedulers advance, the population is reweighted
+ * by the change of G::log_weight() and resampled (systematic resampling), the
+ * size stays R. A replica that is not resampled lends its buffers to a copy of
+ * one that is resampled more than once (G::copy_state()), i.e. the population
+ * is its own pool and resampling allocates nothing. The mean weights
+ * estimate the free energy difference along the schedule.
+ *
+ * Based on K. Hukushima, Y. Iba (2003), AIP Conference Proceedings 690, 200
+ * and J. Machta (2010), Phys. Rev. E 82, 026704.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_POPULATION_ANNEALING_HPP_GUARD
+#define SIQUAN_ALGO_POPULATION_ANNEALING_HPP_GUARD
+
+#include "../param.hpp"
+
+#include <fsc/stdSupport.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+
+    /// \brief Anneals a population of grids and resamples it by the
+    /// Boltzmann weights whenever the schedule advances
+    /// \tparam G is the grid type (a compose<...>), which needs to provide
+    /// the type \p size_type, log_weight(), copy_state() and energy() after
+    /// finish() (e.g. analyze_energy)
+    template <typename G>
+    class population_annealing {
+    public:
+        /*==using declarations===*/
+        using grid_type = G;
+        using size_type = typename G::size_type;
+
+        /// \brief param stage, holds the param of the replicas
+        struct param : public seed_param {
+            typename G::param replica;  ///< shared by all replicas but seed
+            size_type population;       ///< amount of replicas
+            uint32_t threads;           ///< threads that step the replicas
+
+            /// \brief dumps the param of the replicas, \p population and
+            /// \p threads to \p "replica_threads" to the map \p m
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void to_map(M &m) const {
+                replica.to_map(m);
+                seed_param::to_map(m);
+                m["population"] = std::to_string(population);
+                m["replica_threads"] = std::to_string(threads);
+            }
+            /// \brief loads "population" and "replica_threads" from the map
+            /// \p m and the param of the replicas
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void from_map(M const &m) {
+                seed_param::from_map(m);
+                replica.from_map(m);
+                population =
+                    fsc::sto<size_type>(fsc::get(m, "population", "100"));
+                threads =
+                    fsc::sto<uint32_t>(fsc::get(m, "replica_threads", "1"));
+            }
+        };
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructs \p population grids with own seeds and seeds
+        /// the own RNG
+        population_annealing(param const &p)
+            : threads_(std::max(p.threads, uint32_t(1))),
+              started_(false),
+              log_z_ratio_(0),
+              resamplings_(0),
+              log_w_(p.population, 0),
+              copies_(p.population, 0),
+              family_(p.population, 0),
+              drand(0, 1) {
+            if(p.population == 0)
+                throw std::runtime_error(
+                    "population_annealing: population needs to be positive");
+            rnd_generator.seed(p.seed_rng());
+            for(size_type i = 0; i < p.population; ++i) {
+                auto rp = p.replica;
+                rp.set_seed(static_cast<uint32_t>(p.seed_rng()));
+                replica_.emplace_back(rp);
+                family_[i] = i;
+            }
+        }
+        /*===modifying methods===*/
+        /// \brief initializes all replicas
+        /// \details serial, since reading a problem is not thread safe
+        void init() {
+            for(auto &g : replica_) g.init();
+        }
+        /// \brief updates all replicas
+        void update() {
+            for(auto &g : replica_) g.update();
+        }
+        /// \brief advances all replicas in parallel
+        void step() {
+            parallel_([](G &g) { g.step(); });
+            started_ = true;
+        }
+        /// \brief advances the schedulers of all replicas, then reweights
+        /// and resamples the population
+        template <typename O>
+        void advance(O const &o) {
+            if(not started_) {  // nothing to reweight yet
+                for(auto &g : replica_) g.advance(o);
+                return;
+            }
+            size_type const n = replica_.size();
+            for(size_type i = 0; i < n; ++i)
+                log_w_[i] = -replica_[i].log_weight();
+            for(auto &g : replica_) g.advance(o);
+            for(size_type i = 0; i < n; ++i)
+                log_w_[i] += replica_[i].log_weight();
+            resample_();
+        }
+        /// \brief finishes all replicas
+        void finish() {
+            parallel_([](G &g) { g.finish(); });
+        }
+        /*==== const methods ====*/
+        /// \brief true if the replicas stop (they share the schedule)
+        bool stop() const { return replica_.front().stop(); }
+        /// \brief get the amount of replicas
+        size_type size() const { return replica_.size(); }
+        /// \brief get the replica \p i
+        G const &operator[](size_type const &i) const { return replica_[i]; }
+        /// \brief get the estimate of log(Z_now / Z_start), i.e. the
+        /// difference of beta * F between the start and now
+        double const &log_z_ratio() const { return log_z_ratio_; }
+        /// \brief get the amount of distinct initial replicas that still
+        /// have descendants, few families mean a too small population
+        size_type families() const {
+            return std::set<size_type>(family_.begin(), family_.end()).size();
+        }
+        /// \brief get the replica with the lowest energy
+        /// \pre finish() was called
+        size_type best() const {
+            size_type res = 0;
+            for(size_type i = 1; i < replica_.size(); ++i)
+                if(replica_[i].energy() < replica_[res].energy()) res = i;
+            return res;
+        }
+
+        /// \brief dumps the best replica to the map \p m, as well as
+        /// \p log_z_ratio to \p "log_z_ratio", \p families to \p "families"
+        /// and the mean energy of the population to \p "mean_energy"
+        /// \param m \p std::map<std::string, std::string> like instance.
+        /// \pre finish() was called
+        template <typename M>
+        void to_map(M &m) const {
+            replica_[best()].to_map(m);
+            double mean = 0;
+            for(auto const &g : replica_) mean += g.energy();
+            m["mean_energy"] = std::to_string(mean / replica_.size());
+            m["log_z_ratio"] = std::to_string(log_z_ratio());
+            m["families"] = std::to_string(families());
+            m["resamplings"] = std::to_string(resamplings_);
+        }
+        /// \brief print some information about the population
+        void print() const {
+            std::cout << "Population Annealing: " << replica_.size()
+                      << " replicas, " << families() << " families"
+                      << std::endl;
+            std::cout << "log(Z/Z_0): " << log_z_ratio() << std::endl;
+        }
+
+    private:
+        // f(g) for all replicas, one contiguous part per thread
+        template <typename F>
+        void parallel_(F &&f) {
+            int const n = static_cast<int>(replica_.size());
+            int const n_threads = static_cast<int>(threads_);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+            for(int i = 0; i < n; ++i) f(replica_[i]);
+            (void)n_threads;
+        }
+        // systematic resampling with the weights exp(log_w_), the replicas
+        // without copies are overwritten by the extra copies of others
+        void resample_() {
+            size_type const n = replica_.size();
+            double const shift =
+                *std::max_element(log_w_.begin(), log_w_.end());
+            double sum = 0;
+            for(auto &w : log_w_) sum += (w = std::exp(w - shift));
+            log_z_ratio_ += shift + std::log(sum / n);
+            ++resamplings_;
+
+            double const u = drand(rnd_generator);
+            double acc = 0;
+            size_type total = 0;
+            for(size_type i = 0; i < n; ++i) {
+                acc += log_w_[i] * n / sum;
+                // copies up to replica i: floor(acc + u), at most n
+                size_type const upto =
+                    std::min(n, static_cast<size_type>(acc + u));
+                copies_[i] = upto - total;
+                total = upto;
+            }
+            copies_[n - 1] += n - total;  // rounding of acc
+
+            free_.clear();
+            moves_.clear();
+            for(size_type i = 0; i < n; ++i)
+                if(copies_[i] == 0) free_.push_back(i);
+            for(size_type i = 0; i < n; ++i)
+                for(size_type c = 1; c < copies_[i]; ++c) {
+                    moves_.emplace_back(free_.back(), i);
+                    free_.pop_back();
+                }
+
+            int const n_moves = static_cast<int>(moves_.size());
+            int const n_threads = static_cast<int>(threads_);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+            for(int k = 0; k < n_moves; ++k)
+                replica_[moves_[k].first].copy_state(
+                    replica_[moves_[k].second]);
+            (void)n_threads;
+            for(auto const &mv : moves_) family_[mv.first] = family_[mv.second];
+        }
+
+    private:
+        uint32_t const threads_;
+        bool started_;  // reweight only after the first sweep
+        double log_z_ratio_;
+        size_type resamplings_;
+        std::deque<G> replica_;  // constructed in place, G needs no moves
+        std::vector<double> log_w_;   // log weight changes, then weights
+        std::vector<size_type> copies_;  // of replica i after resampling
+        std::vector<size_type> family_;  // initial ancestor of replica i
+        std::vector<size_type> free_;    // replicas without copies
+        std::vector<std::pair<size_type, size_type>> moves_;  // to, from
+        std::uniform_real_distribution<double> drand;
+        std::mt19937 rnd_generator;  // only for the resampling
+    };
+
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_POPULATION_ANNEALING_HPP_GUARD
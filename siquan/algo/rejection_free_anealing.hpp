@@ -0,0 +1,278 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief a rejection-free (n-fold way) classical annealing code
+ * \details Based on A.B. Bortz, M.H. Kalos, J.L. Lebowitz (1975), Journal of
+ * Computational Physics, vol. 17, no. 1, pages 10-18: the Metropolis rates of
+ * all spins are kept in a util::sum_tree, the next accepted flip is drawn
+ * proportional to its rate and the amount of attempts the Metropolis chain of
+ * simulated_anealing would have rejected before it is drawn from the
+ * geometric distribution. A step covers the same amount of attempts as a step
+ * of simulated_anealing, but costs O(log n) per accepted flip only.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_REJECTION_FREE_ANEALING_HPP_GUARD
+#define SIQUAN_ALGO_REJECTION_FREE_ANEALING_HPP_GUARD
+
+#include "../tools/random.hpp"
+#include "../tools/sum_tree.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+
+    /// \brief Rejection-free classical annealing with the same acceptance as
+    /// simulated_anealing
+    /// \tparam super is the parent module which needs to provide the types
+    /// \p size_type, \p state_type, \p weight_type and \p temp_type
+    template <typename super>
+    class rejection_free_anealing : public super {
+        using s_param = typename super::param;
+
+    public:
+        /*==using declarations===*/
+        using typename super::state_type;
+        using typename super::weight_type;
+        using typename super::temp_type;
+        using typename super::size_type;
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructor argument for super and seeds own RNGs
+        rejection_free_anealing(s_param const &p)
+            : super(p),
+              T_(-1),
+              energy_(0),
+              maxcut_(0),
+              attempts_(0),
+              flips_(0),
+              prob_(0, 1) {
+            prob_.seed(p.seed_rng());
+        }
+        /*===modifying methods===*/
+        /// \brief initializes super and then the module
+        /// \details calculates the energy difference of every spin and the
+        /// energy of the initial state from the signs of the interactions
+        void init() {
+            super::init();
+
+            auto const &con = super::get_state_connect();
+            auto const &lat = super::get_state();
+
+            // number the interactions, state_connect may point to another
+            // connect vector than super::get_connect() (normalize_weight)
+            std::map<typename super::connect_type const *, size_type> ids;
+            iact_id_.assign(con.size(), std::vector<size_type>());
+            for(size_type i = 0; i < con.size(); ++i)
+                for(auto const &iact : con[i])
+                    iact_id_[i].push_back(
+                        ids.emplace(iact, ids.size()).first->second);
+            // the energy is counted like analyze_energy: +w for an even
+            // amount of up spins (0) in an interaction, -w otherwise
+            sign_.assign(ids.size(), 0);
+            energy_ = 0;
+            weight_type weight_sum = 0;
+            for(auto const &id : ids) {
+                bool same = id.first->vert_vec.size() % 2;
+                for(auto const &e : id.first->vert_vec) same ^= lat[e];
+                sign_[id.second] = not same;
+                energy_ += same ? id.first->weight : -id.first->weight;
+                weight_sum += id.first->weight;
+            }
+            maxcut_ = (weight_sum + energy_) / (-2);
+            ediff_.assign(con.size(), 0);
+            for(size_type i = 0; i < con.size(); ++i) {
+                for(size_type k = 0; k < con[i].size(); ++k) {
+                    auto const &iact = con[i][k];
+                    auto const &vv = iact->vert_vec;
+                    // a self coupling (i, i) is constant
+                    if(vv.size() == 2 and vv[0] == vv[1]) continue;
+                    ediff_[i] += sign_[iact_id_[i][k]] ? iact->weight
+                                                       : -iact->weight;
+                }
+            }
+            rates_.resize(con.size());
+        }
+        /// \brief advances the state of the super and then the module's state
+        /// \details flips spins until the attempts of N_vert() Metropolis
+        /// updates are used up
+        void step() {
+            super::step();
+
+            double const n = super::get_state().size();
+            double left = n;
+            while(rates_.total() > 0) {
+                // probability that an attempt of the Metropolis chain is
+                // accepted, the attempts until then are geometric
+                double const p = rates_.total() / n;
+                double attempts = 1;
+                if(p < 1)
+                    attempts += std::floor(std::log(1 - prob_()) /
+                                           std::log1p(-p));
+                if(attempts > left) break;
+                left -= attempts;
+                attempts_ += attempts;
+                flip_(rates_.find(prob_() * rates_.total()));
+            }
+            attempts_ += left;  // the rejected tail of the sweep
+        }
+
+        // scheduler
+        /// \brief updates the super and then recalculates the rates if the
+        /// temperature changed
+        void update() {
+            super::update();
+
+            if(super::temperature() != T_) {
+                T_ = super::temperature();
+                rates_.assign([this](size_type const &i) {
+                    return rate_(ediff_[i]);
+                });
+            }
+        }
+        /// \brief swaps the configuration and the cached energy differences
+        /// with the grid \p g of the same type
+        template <typename G>
+        void swap_state(G &g) {
+            super::swap_state(g);
+            auto &b = static_cast<rejection_free_anealing &>(g);
+            std::swap(energy_, b.energy_);
+            std::swap(maxcut_, b.maxcut_);
+            std::swap(sign_, b.sign_);
+            std::swap(ediff_, b.ediff_);
+            // the rates belong to the own temperature
+            rates_.assign([this](size_type const &i) {
+                return rate_(ediff_[i]);
+            });
+            b.rates_.assign([&b](size_type const &i) {
+                return b.rate_(b.ediff_[i]);
+            });
+        }
+        /// \brief copies the configuration and the cached energy differences
+        /// of the grid \p g of the same type into the own buffers
+        template <typename G>
+        void copy_state(G const &g) {
+            super::copy_state(g);
+            auto const &b = static_cast<rejection_free_anealing const &>(g);
+            energy_ = b.energy_;
+            maxcut_ = b.maxcut_;
+            sign_ = b.sign_;
+            ediff_ = b.ediff_;
+            rates_ = b.rates_;  // same schedule, i.e. same temperature
+        }
+        /*==== const methods ====*/
+        /// \brief get the current energy
+        double const &energy() const { return energy_; }
+        /// \brief get the current maxcut
+        double const &maxcut() const { return maxcut_; }
+        /// \brief logarithm of the (unnormalized) Boltzmann weight of the
+        /// configuration at the current temperature, i.e.
+        /// -energy() / (2 T), see exchange_log_ratio()
+        double log_weight() const {
+            return -energy_ / (2 * super::temperature());
+        }
+        /// \brief logarithm of the Metropolis ratio of exchanging the
+        /// configurations with the grid \p g of the same type, that may run
+        /// at another temperature
+        /// \details The chain samples exp(-energy() / (2 T)), since the
+        /// energy difference of a flip is half the change of energy().
+        template <typename G>
+        double exchange_log_ratio(G const &g) const {
+            auto const &b = static_cast<rejection_free_anealing const &>(g);
+            return (1 / super::temperature() - 1 / b.super::temperature()) *
+                   (energy_ - b.energy_) / 2;
+        }
+        /// \brief get the amount of Metropolis attempts covered so far
+        double const &attempts() const { return attempts_; }
+        /// \brief get the amount of accepted flips so far
+        size_type const &flips() const { return flips_; }
+
+        /// \brief dumps \p flips to \p "flips" in the map \p m
+        /// \param m \p std::map<std::string, std::string> like instance.
+        template <typename M>
+        void to_map(M &m) const {
+            super::to_map(m);
+            m["flips"] = std::to_string(flips());
+        }
+
+        /// \brief print the super and then some information about the module
+        void print() {
+            super::print();
+
+            std::cout << "Rejection Free Annealing: " << std::endl;
+            std::cout << "energy:   " << energy() << std::endl;
+            std::cout << "maxcut:   " << maxcut() << std::endl;
+            std::cout << "flips:    " << flips() << std::endl;
+        }
+
+    private:
+        // Metropolis acceptance of simulated_anealing
+        double rate_(double const &E_diff) const {
+            return E_diff <= 0 ? 1 : std::exp(-E_diff / T_);
+        }
+        // flips spin pos and updates the energy differences and rates of all
+        // spins that share an interaction with it
+        void flip_(size_type const &pos) {
+            auto const &con = super::get_state_connect();
+            auto &lat = super::prot_get_state();
+
+            double const E_diff = ediff_[pos];
+            lat[pos] = !lat[pos];
+            maxcut_ -= E_diff;
+            energy_ += 2 * E_diff;
+            ++flips_;
+
+            // every occurrence of pos toggles the sign once, s.t. even
+            // multiplicities cancel
+            for(size_type k = 0; k < con[pos].size(); ++k) {
+                auto const &iact = con[pos][k];
+                auto &s = sign_[iact_id_[pos][k]];
+                double const c = 2 * (s ? iact->weight : -iact->weight);
+                s = not s;
+                for(auto const &e : iact->vert_vec) ediff_[e] -= c;
+            }
+            for(auto const &iact : con[pos])
+                for(auto const &e : iact->vert_vec)
+                    rates_.set(e, rate_(ediff_[e]));
+        }
+
+    private:
+        temp_type T_;
+        weight_type energy_;
+        weight_type maxcut_;
+        double attempts_;
+        size_type flips_;
+        std::vector<char> sign_;      // per interaction, see init()
+        std::vector<std::vector<size_type>> iact_id_;  // sign_ of con[i][k]
+        std::vector<double> ediff_;   // energy difference if flipped
+        util::sum_tree<double> rates_;
+        util::rng_class<double> prob_;
+    };
+
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_REJECTION_FREE_ANEALING_HPP_GUARD
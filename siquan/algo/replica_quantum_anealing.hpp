@@ -0,0 +1,252 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief a multi spin coded simulated quantum annealing that runs 32 or 64
+ * independent replicas in one sweep
+ * \details Bit \p r of every word of the state belongs to replica \p r. The
+ * interaction graph is traversed once per slice for all replicas, the energy
+ * differences are accumulated with one vector lane per replica and the
+ * Metropolis decision yields a word of accepted flips. The updates are local
+ * in space and imaginary time (no cluster moves, as the clusters differ
+ * between replicas).
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_REPLICA_QUANTUM_ANEALING_HPP_GUARD
+#define SIQUAN_ALGO_REPLICA_QUANTUM_ANEALING_HPP_GUARD
+
+#include "legacy/fastmath.hpp"
+#include "simd.hpp"
+
+#include <fsc/stdSupport.hpp>
+
+#include "../types/aligned_allocator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+
+    /// \brief This module provides a multi spin coded simulated quantum
+    /// annealing implementation for many independent replicas
+    /// \tparam super is the parent module which needs to provide the types
+    /// \p state_type (<tt>std::vector<types::ReplicaLine<W>></tt>),
+    /// \p size_type and \p rng_type
+    template <typename super>
+    class replica_quantum_anealing : public super {
+        using s_param = typename super::param;
+        using replica_line_type = typename super::state_type::value_type;
+        using word_type = typename replica_line_type::value_type;
+        using rng_type = typename super::rng_type;
+
+    public:
+        /*==using declarations===*/
+        using typename super::state_type;
+        using typename super::size_type;
+
+        /// \brief param stage for this module
+        struct param : public s_param {
+            bool periodic;
+            ///< specifies if the world-lines should periodic (1) or not (0)
+
+            /// \brief dumps \p periodic to \p "periodic" in the map \p m
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void to_map(M &m) const {
+                s_param::to_map(m);
+                m["periodic"] = std::to_string(periodic);
+            }
+            /// \brief loads "periodic" from the map \p m into \p periodic
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void from_map(M const &m) {
+                s_param::from_map(m);
+                periodic = fsc::sto<int>(fsc::get(m, "periodic", "1"));
+            }
+        };
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructor argument for super and seeds own RNGs
+        replica_quantum_anealing(param const &p)
+            : super(p),
+              NT(super::get_nt()),
+              periodic_(p.periodic),
+              h_field_(),
+              delta_(replica_line_type::n_replica),
+              drand(0, 1),
+              tau_(0),
+              jperp_(0),
+              pool_(0),
+              pool_bytes_(0) {
+            rnd_generator.seed(p.seed_rng());
+            fexp.set_coefficient(-1);
+        }
+        /*===modifying methods===*/
+        /// \brief initializes super and then the module
+        /// \details randomizes every replica and moves the fields out of the
+        /// interaction pool
+        void init() {
+            super::init();
+
+            auto &lat = super::prot_get_state();
+            auto &con = super::prot_get_state_connect();
+
+            for(auto &site : lat)
+                for(auto &w : site) w = static_cast<word_type>(rnd_generator());
+
+            h_field_.assign(super::n_vert(), 0);
+            for(size_type idx = 0; idx < super::n_vert(); ++idx) {
+                auto it = std::find_if(con[idx].begin(), con[idx].end(),
+                                       [](auto const &iptr) {
+                                           return iptr->vert_vec.size() == 1;
+                                       });
+                if(it != con[idx].end()) {
+                    h_field_[idx] = (*it)->weight;
+                    con[idx].erase(it);
+                }
+            }
+        }
+
+        /// \brief advances the state of the super and then the module's state
+        /// \details one Metropolis sweep over all spins and slices of all
+        /// replicas
+        void step() {
+            super::step();
+
+            auto &lat = super::prot_get_state();
+            auto const &con = super::get_state_connect();
+            auto const n = replica_line_type::n_replica;
+            double *d = delta_.data();
+
+            for(size_type i = 0; i < lat.size(); ++i) {
+                auto &site = lat[i];
+                double const h2 = 2 * tau_ * h_field_[i];
+                for(size_type ts = 0; ts < NT; ++ts) {
+                    word_type const s = site[ts];
+                    // action difference of flipping spin (i, ts) per replica
+                    std::fill(delta_.begin(), delta_.end(), 0.);
+                    simd::add_signed(d, s, h2, n);
+                    for(auto const &iptr : con[i]) {
+                        word_type alignment = 0;
+                        for(auto const &nb : iptr->vert_vec)
+                            alignment ^= lat[nb][ts];
+                        simd::add_signed(d, alignment,
+                                         2 * tau_ * iptr->weight, n);
+                    }
+                    if(NT > 1) {
+                        if(periodic_ or ts > 0)
+                            simd::add_signed(
+                                d, s ^ site[ts == 0 ? NT - 1 : ts - 1],
+                                2 * jperp_, n);
+                        if(periodic_ or ts + 1 < NT)
+                            simd::add_signed(
+                                d, s ^ site[ts + 1 == NT ? 0 : ts + 1],
+                                2 * jperp_, n);
+                    }
+                    site[ts] ^= accept_(d);
+                }
+            }
+        }
+
+        /// \brief updates the super and gets the new state of the schedulers
+        void update() {
+            super::update();
+            tau_ = 1 / (super::temperature() * NT);  // tau = beta/nr_ts
+            // coupling of neighbouring slices, finite for a vanishing field
+            double const th =
+                std::tanh(tau_ * std::abs(super::transverse_field()));
+            jperp_ = th > 0 ? std::min(-0.5 * std::log(th), max_jperp_)
+                            : max_jperp_;
+        }
+        /*==== const methods ====*/
+        /// \brief what we refer to a up spin
+        int spin_up() const { return 0; }
+
+        /// \brief print information about super, then of the own module
+        void print() {
+            super::print();
+            std::cout << "Replica Quantum Annealing: "
+                      << replica_line_type::n_replica << " replicas"
+                      << std::endl;
+        }
+
+    private:
+        // word of accepted flips for the action differences d
+        word_type accept_(double const *d) {
+            auto const n = replica_line_type::n_replica;
+            uint64_t acc = simd::less_equal_mask(d, 0., n);
+            uint64_t cand = simd::less_equal_mask(d, max_delta_, n) & ~acc;
+            // u = (c + f) / 256 with a coarse byte c and a fine part f, that
+            // is only drawn if c alone does not decide u < exp(-d)
+            while(cand) {
+                auto const k = __builtin_ctzll(cand);
+                if(pool_bytes_ == 0) {
+                    pool_ = rnd_generator();
+                    pool_bytes_ = sizeof(typename rng_type::result_type);
+                }
+                auto const c = static_cast<unsigned>(pool_ & 0xff);
+                pool_ >>= 8;
+                --pool_bytes_;
+                // c > 0 rejects without exp if exp(-d) < 1/256
+                if(c == 0 or d[k] < ln256_) {
+                    double const t = 256 * fexp(d[k]);
+                    if(c + 1 <= t or (c < t and drand(rnd_generator) < t - c))
+                        acc |= uint64_t(1) << k;
+                }
+                cand &= cand - 1;  // delete lowest bit
+            }
+            return static_cast<word_type>(acc);
+        }
+
+    private:
+        // exp(-40) is below the resolution of drand
+        static constexpr double max_delta_ = 40;
+        static constexpr double max_jperp_ = max_delta_;
+        static constexpr double ln256_ = 5.545177444479562;
+
+        const uint32_t NT;
+        bool periodic_;
+        std::vector<double> h_field_;
+        std::vector<double, types::aligned_allocator<double>> delta_;
+        std::uniform_real_distribution<double> drand;
+        double tau_;    // beta / nt
+        double jperp_;  // coupling between neighbouring slices
+        fastmath::exp<true, 12> fexp;
+        mutable rng_type rnd_generator;
+        uint64_t pool_;           // unused random bytes for accept_
+        std::size_t pool_bytes_;  // amount of bytes left in pool_
+    };
+
+    template <typename super>
+    constexpr double replica_quantum_anealing<super>::max_delta_;
+    template <typename super>
+    constexpr double replica_quantum_anealing<super>::max_jperp_;
+    template <typename super>
+    constexpr double replica_quantum_anealing<super>::ln256_;
+
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_REPLICA_QUANTUM_ANEALING_HPP_GUARD
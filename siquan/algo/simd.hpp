@@ -0,0 +1,341 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief bitmask driven kernels for the local energies of the trotter slices
+ * and of multi spin coded replicas
+ * \details The instruction set is selected at compile time (AVX-512, AVX2 or
+ * scalar), depending on what the compiler targets (e.g. -march=native). The
+ * energy kernels have vector versions for \p double, \p float and \p int32_t.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_ALGO_SIMD_HPP_GUARD
+#define SIQUAN_ALGO_SIMD_HPP_GUARD
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace siquan {  // documented in base.hpp
+namespace algo {    // documented in algo.hpp
+    /// \brief Vectorized kernels that work on whole words of trotter-lines
+    namespace simd {
+        /// \cond IMPLEMENTATION_DETAIL_DOC
+        namespace detail {
+            // ener[k] -= a_k ? w2 : -w2 for all set bits k of u
+            template <typename T>
+            struct update_word {
+                static inline void apply(T *ener, uint64_t u, uint64_t const a,
+                                         T const &w2, std::size_t const &) {
+                    while(u) {
+                        auto const k = __builtin_ctzll(u);
+                        ener[k] -= ((a >> k) & 1) ? w2 : -w2;
+                        u &= u - 1;  // delete lowest bit
+                    }
+                }
+            };
+            // d[k] += a_k ? -c : c for k < n
+            template <typename T>
+            struct add_signed_word {
+                static inline void apply(T *d, uint64_t const a, T const &c,
+                                         std::size_t const &n) {
+                    for(std::size_t k = 0; k < n; ++k)
+                        d[k] += ((a >> k) & 1) ? -c : c;
+                }
+            };
+            // bit k set if d[k] <= x for k < n
+            template <typename T>
+            struct less_equal_word {
+                static inline uint64_t apply(T const *d, T const &x,
+                                             std::size_t const &n) {
+                    uint64_t res = 0;
+                    for(std::size_t k = 0; k < n; ++k)
+                        res |= uint64_t(d[k] <= x) << k;
+                    return res;
+                }
+            };
+#if defined(__AVX512F__)
+            template <>
+            struct update_word<double> {
+                static inline void apply(double *ener, uint64_t const u,
+                                         uint64_t const a, double const &w2,
+                                         std::size_t const &n) {
+                    __m512d const pos = _mm512_set1_pd(w2);
+                    __m512d const neg = _mm512_set1_pd(-w2);
+                    for(std::size_t k = 0; k < n && (u >> k); k += 8) {
+                        __mmask8 const um = static_cast<__mmask8>(u >> k);
+                        if(!um) continue;
+                        __mmask8 const am = static_cast<__mmask8>(a >> k);
+                        // add -w2 where aligned and w2 otherwise
+                        __m512d const d = _mm512_mask_blend_pd(am, pos, neg);
+                        __m512d const e = _mm512_load_pd(ener + k);
+                        _mm512_store_pd(ener + k,
+                                        _mm512_mask_add_pd(e, um, e, d));
+                    }
+                }
+            };
+            template <>
+            struct update_word<float> {
+                static inline void apply(float *ener, uint64_t const u,
+                                         uint64_t const a, float const &w2,
+                                         std::size_t const &n) {
+                    __m512 const pos = _mm512_set1_ps(w2);
+                    __m512 const neg = _mm512_set1_ps(-w2);
+                    for(std::size_t k = 0; k < n && (u >> k); k += 16) {
+                        __mmask16 const um = static_cast<__mmask16>(u >> k);
+                        if(!um) continue;
+                        __mmask16 const am = static_cast<__mmask16>(a >> k);
+                        __m512 const d = _mm512_mask_blend_ps(am, pos, neg);
+                        __m512 const e = _mm512_load_ps(ener + k);
+                        _mm512_store_ps(ener + k,
+                                        _mm512_mask_add_ps(e, um, e, d));
+                    }
+                }
+            };
+            template <>
+            struct update_word<int32_t> {
+                static inline void apply(int32_t *ener, uint64_t const u,
+                                         uint64_t const a, int32_t const &w2,
+                                         std::size_t const &n) {
+                    __m512i const pos = _mm512_set1_epi32(w2);
+                    __m512i const neg = _mm512_set1_epi32(-w2);
+                    for(std::size_t k = 0; k < n && (u >> k); k += 16) {
+                        __mmask16 const um = static_cast<__mmask16>(u >> k);
+                        if(!um) continue;
+                        __mmask16 const am = static_cast<__mmask16>(a >> k);
+                        __m512i const d = _mm512_mask_blend_epi32(am, pos, neg);
+                        __m512i const e = _mm512_load_si512(ener + k);
+                        _mm512_store_si512(ener + k,
+                                           _mm512_mask_add_epi32(e, um, e, d));
+                    }
+                }
+            };
+            template <>
+            struct add_signed_word<double> {
+                static inline void apply(double *d, uint64_t const a,
+                                         double const &c,
+                                         std::size_t const &n) {
+                    __m512d const pos = _mm512_set1_pd(c);
+                    __m512d const neg = _mm512_set1_pd(-c);
+                    for(std::size_t k = 0; k < n; k += 8) {
+                        __mmask8 const am = static_cast<__mmask8>(a >> k);
+                        _mm512_store_pd(
+                            d + k, _mm512_add_pd(_mm512_load_pd(d + k),
+                                                 _mm512_mask_blend_pd(
+                                                     am, pos, neg)));
+                    }
+                }
+            };
+            template <>
+            struct less_equal_word<double> {
+                static inline uint64_t apply(double const *d, double const &x,
+                                             std::size_t const &n) {
+                    __m512d const xv = _mm512_set1_pd(x);
+                    uint64_t res = 0;
+                    for(std::size_t k = 0; k < n; k += 8)
+                        res |= uint64_t(_mm512_cmp_pd_mask(
+                                   _mm512_load_pd(d + k), xv, _CMP_LE_OQ))
+                               << k;
+                    return res;
+                }
+            };
+#elif defined(__AVX2__)
+            // one lane (all bits set) per bit of the lowest 4 bits of b
+            inline __m256d expand4(uint64_t const &b) {
+                __m256i const lane = _mm256_set_epi64x(8, 4, 2, 1);
+                __m256i const x = _mm256_set1_epi64x(b & 0xf);
+                return _mm256_castsi256_pd(
+                    _mm256_cmpeq_epi64(_mm256_and_si256(x, lane), lane));
+            }
+            template <>
+            struct update_word<double> {
+                static inline void apply(double *ener, uint64_t const u,
+                                         uint64_t const a, double const &w2,
+                                         std::size_t const &n) {
+                    __m256d const pos = _mm256_set1_pd(w2);
+                    __m256d const neg = _mm256_set1_pd(-w2);
+                    for(std::size_t k = 0; k < n && (u >> k); k += 4) {
+                        if(!((u >> k) & 0xf)) continue;
+                        __m256d const um = expand4(u >> k);
+                        __m256d const am = expand4(a >> k);
+                        // add -w2 where aligned and w2 otherwise
+                        __m256d const d = _mm256_blendv_pd(pos, neg, am);
+                        __m256d const e = _mm256_load_pd(ener + k);
+                        _mm256_store_pd(
+                            ener + k,
+                            _mm256_blendv_pd(e, _mm256_add_pd(e, d), um));
+                    }
+                }
+            };
+            // one lane (all bits set) per bit of the lowest 8 bits of b
+            inline __m256i expand8(uint64_t const &b) {
+                __m256i const lane =
+                    _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+                __m256i const x = _mm256_set1_epi32(int(b & 0xff));
+                return _mm256_cmpeq_epi32(_mm256_and_si256(x, lane), lane);
+            }
+            template <>
+            struct update_word<float> {
+                static inline void apply(float *ener, uint64_t const u,
+                                         uint64_t const a, float const &w2,
+                                         std::size_t const &n) {
+                    __m256 const pos = _mm256_set1_ps(w2);
+                    __m256 const neg = _mm256_set1_ps(-w2);
+                    for(std::size_t k = 0; k < n && (u >> k); k += 8) {
+                        if(!((u >> k) & 0xff)) continue;
+                        __m256 const um = _mm256_castsi256_ps(expand8(u >> k));
+                        __m256 const am = _mm256_castsi256_ps(expand8(a >> k));
+                        __m256 const d = _mm256_blendv_ps(pos, neg, am);
+                        __m256 const e = _mm256_load_ps(ener + k);
+                        _mm256_store_ps(
+                            ener + k,
+                            _mm256_blendv_ps(e, _mm256_add_ps(e, d), um));
+                    }
+                }
+            };
+            template <>
+            struct update_word<int32_t> {
+                static inline void apply(int32_t *ener, uint64_t const u,
+                                         uint64_t const a, int32_t const &w2,
+                                         std::size_t const &n) {
+                    __m256i const pos = _mm256_set1_epi32(w2);
+                    __m256i const neg = _mm256_set1_epi32(-w2);
+                    for(std::size_t k = 0; k < n && (u >> k); k += 8) {
+                        if(!((u >> k) & 0xff)) continue;
+                        __m256i const um = expand8(u >> k);
+                        __m256i const d =
+                            _mm256_blendv_epi8(pos, neg, expand8(a >> k));
+                        auto const p = reinterpret_cast<__m256i *>(ener + k);
+                        __m256i const e = _mm256_load_si256(p);
+                        // masked lanes add zero
+                        _mm256_store_si256(
+                            p, _mm256_add_epi32(e, _mm256_and_si256(d, um)));
+                    }
+                }
+            };
+            template <>
+            struct add_signed_word<double> {
+                static inline void apply(double *d, uint64_t const a,
+                                         double const &c,
+                                         std::size_t const &n) {
+                    __m256d const pos = _mm256_set1_pd(c);
+                    __m256d const neg = _mm256_set1_pd(-c);
+                    for(std::size_t k = 0; k < n; k += 4) {
+                        __m256d const am = expand4(a >> k);
+                        _mm256_store_pd(
+                            d + k, _mm256_add_pd(_mm256_load_pd(d + k),
+                                                 _mm256_blendv_pd(pos, neg,
+                                                                  am)));
+                    }
+                }
+            };
+            template <>
+            struct less_equal_word<double> {
+                static inline uint64_t apply(double const *d, double const &x,
+                                             std::size_t const &n) {
+                    __m256d const xv = _mm256_set1_pd(x);
+                    uint64_t res = 0;
+                    for(std::size_t k = 0; k < n; k += 4)
+                        res |= uint64_t(_mm256_movemask_pd(_mm256_cmp_pd(
+                                   _mm256_load_pd(d + k), xv, _CMP_LE_OQ)))
+                               << k;
+                    return res;
+                }
+            };
+#endif
+        }  // end namespace detail
+        /// \endcond
+
+        /// \brief update_energy() for the single word \p u of updates, i.e. the
+        /// \p n slices at \p ener
+        /// \param ener aligned to 64 bytes and padded to 64 elements
+        template <typename T>
+        inline void update_energy_word(T *ener, uint64_t const &u,
+                                       uint64_t const &alignment, T const &w2,
+                                       std::size_t const &n) {
+            detail::update_word<T>::apply(ener, u, alignment, w2, n);
+        }
+
+        /// \brief subtracts \p w2 from the energy of every slice set in
+        /// \p updates if it is set in \p alignment and adds it otherwise,
+        /// i.e. <tt>ener[ts] -= get_interaction_contribution(alignment[ts],
+        /// w2)</tt>
+        /// \param ener the energies of one spin, aligned to 64 bytes and
+        /// padded to a multiple of 64 bytes
+        /// \param updates,alignment trotter-lines providing \p n_words() and
+        /// \p word(i), with zero bits behind the last slice
+        /// \param w2 twice the interaction strength
+        template <typename T, typename line_type>
+        inline void update_energy(T *ener, line_type const &updates,
+                                  line_type const &alignment, T const &w2) {
+            std::size_t const NT = updates.size();
+            for(std::size_t i = 0; i < updates.n_words(); ++i) {
+                uint64_t const u = updates.word(i);
+                if(u == 0) continue;
+                detail::update_word<T>::apply(
+                    ener + 64 * i, u, alignment.word(i), w2,
+                    std::min<std::size_t>(64, NT - 64 * i));
+            }
+        }
+        /// \brief same as update_energy() with <tt>alignment = lhs ^ rhs</tt>,
+        /// the alignment is only formed for words with updates
+        /// \param lhs,rhs the trotter-lines of the two spins of a 2-body
+        /// interaction
+        template <typename T, typename line_type>
+        inline void update_energy(T *ener, line_type const &updates,
+                                  line_type const &lhs, line_type const &rhs,
+                                  T const &w2) {
+            std::size_t const NT = updates.size();
+            for(std::size_t i = 0; i < updates.n_words(); ++i) {
+                uint64_t const u = updates.word(i);
+                if(u == 0) continue;
+                detail::update_word<T>::apply(
+                    ener + 64 * i, u, lhs.word(i) ^ rhs.word(i), w2,
+                    std::min<std::size_t>(64, NT - 64 * i));
+            }
+        }
+
+        /// \brief adds \p c to <tt>d[k]</tt> if bit \p k of \p a is zero and
+        /// subtracts it otherwise, for all <tt>k < n</tt>
+        /// \details One call handles one word of a multi spin coded state,
+        /// i.e. one value per replica.
+        /// \param d aligned to 64 bytes, \p n is 32 or 64
+        template <typename T>
+        inline void add_signed(T *d, uint64_t const &a, T const &c,
+                               std::size_t const &n) {
+            detail::add_signed_word<T>::apply(d, a, c, n);
+        }
+        /// \brief returns a word with bit \p k set if <tt>d[k] <= x</tt>, for
+        /// all <tt>k < n</tt>
+        /// \param d aligned to 64 bytes, \p n is 32 or 64
+        template <typename T>
+        inline uint64_t less_equal_mask(T const *d, T const &x,
+                                        std::size_t const &n) {
+            return detail::less_equal_word<T>::apply(d, x, n);
+        }
+    }  // end namespace simd
+}  // end namespace algo
+}  // end namespace siquan
+
+#endif  // SIQUAN_ALGO_SIMD_HPP_GUARD
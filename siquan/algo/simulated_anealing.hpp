@@ -25,9 +25,14 @@
 #ifndef SIQUAN_ALGO_SIMULATED_ANEALING_HPP_GUARD
 #define SIQUAN_ALGO_SIMULATED_ANEALING_HPP_GUARD
 
+#include <fsc/stdSupport.hpp>
+
 #include "../tools/random.hpp"
 
+#include <cmath>
 #include <iostream>
+#include <map>
+#include <utility>
 #include <vector>
 
 namespace siquan {  // documented in base.hpp
@@ -47,14 +52,41 @@ namespace algo {    // documented in algo.hpp
         using typename super::temp_type;
         using typename super::size_type;
 
+        /// \brief param stage for this module
+        struct param : public s_param {
+            size_type accept_bins;
+            ///< maximal amount of entries of the acceptance table, the bin
+            ///< width is a power of two, s.t. integer weights are exact
+
+            /// \brief dumps \p accept_bins to \p "accept_bins" in the map
+            /// \p m
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void to_map(M &m) const {
+                s_param::to_map(m);
+                m["accept_bins"] = std::to_string(accept_bins);
+            }
+            /// \brief loads "accept_bins" from the map \p m into
+            /// \p accept_bins
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void from_map(M const &m) {
+                s_param::from_map(m);
+                accept_bins =
+                    fsc::sto<size_type>(fsc::get(m, "accept_bins", "1024"));
+            }
+        };
+
         /*====con-/destructor====*/
         /// \brief Constructor
         /// \param p constructor argument for super and seeds own RNGs
-        simulated_anealing(s_param const &p)
+        simulated_anealing(param const &p)
             : super(p),
               T_(-1),
               sol_(),
+              accept_bins_(std::max<size_type>(p.accept_bins, 1)),
               accept_cache_(),
+              bin_width_(1),
               energy_(0),
               maxcut_(0),
               pos_(0, 1),
@@ -64,12 +96,14 @@ namespace algo {    // documented in algo.hpp
         }
         /*===modifying methods===*/
         /// \brief initializes super and then the module
-        /// \details resizes the state to correct length, sets ranges of RNGs
-        /// and precalculates the lookup table
+        /// \details resizes the state to correct length, sets ranges of RNGs,
+        /// precalculates the lookup table, the energy difference of every
+        /// spin and the energy of the initial state
         void init() {
             super::init();
 
             auto const &con = super::get_state_connect();
+            auto const &lat = super::get_state();
 
             sol_.resize(con.size());
             pos_.set_range(0, con.size() - 1);
@@ -77,43 +111,65 @@ namespace algo {    // documented in algo.hpp
             double max_abs_weight(0);
             for(uint i = 0; i < con.size(); ++i) {
                 double abs_weight = 0;
-                for(auto const &iact : con[i]) {
+                for(auto const &iact : con[i])
                     abs_weight += std::abs(iact->weight);
-                    energy_ -= iact->weight / double(iact->vert_vec.size());
-                }
                 max_abs_weight = std::max(max_abs_weight, abs_weight);
             }
-            // resize lookup (for weights int) accordingly
-            accept_cache_.resize(max_abs_weight + 1);
+            // the largest energy difference is max_abs_weight, the bins are
+            // halved until the table would exceed accept_bins
+            bin_width_ = 1;
+            while(max_abs_weight > bin_width_ * accept_bins_) bin_width_ *= 2;
+            while(max_abs_weight > 0 and
+                  max_abs_weight <= bin_width_ / 2 * accept_bins_)
+                bin_width_ /= 2;
+            accept_cache_.resize(max_abs_weight / bin_width_ + 2);
+
+            // the sign of an interaction is the same for all its spins, a
+            // flip toggles it once per occurrence of the spin. The
+            // interactions are numbered here, since state_connect may point
+            // to another connect vector than super::get_connect()
+            // (normalize_weight)
+            std::map<typename super::connect_type const *, size_type> ids;
+            iact_id_.assign(con.size(), std::vector<size_type>());
+            for(size_type i = 0; i < con.size(); ++i)
+                for(auto const &iact : con[i])
+                    iact_id_[i].push_back(
+                        ids.emplace(iact, ids.size()).first->second);
+            // the energy is counted like analyze_energy: +w for an even
+            // amount of up spins (0) in an interaction, -w otherwise
+            sign_.assign(ids.size(), 0);
+            energy_ = 0;
+            weight_type weight_sum = 0;
+            for(auto const &id : ids) {
+                bool same = id.first->vert_vec.size() % 2;
+                for(auto const &e : id.first->vert_vec) same ^= lat[e];
+                sign_[id.second] = not same;
+                energy_ += same ? id.first->weight : -id.first->weight;
+                weight_sum += id.first->weight;
+            }
+            maxcut_ = (weight_sum + energy_) / (-2);
+            ediff_.assign(con.size(), 0);
+            for(size_type i = 0; i < con.size(); ++i)
+                for(size_type k = 0; k < con[i].size(); ++k) {
+                    auto const &vv = con[i][k]->vert_vec;
+                    // a self coupling (i, i) is constant
+                    if(vv.size() == 2 and vv[0] == vv[1]) continue;
+                    ediff_[i] += sign_[iact_id_[i][k]] ? con[i][k]->weight
+                                                       : -con[i][k]->weight;
+                }
         }
         /// \brief advances the state of the super and then the module's state
-        /// \details attempts to do single spins updates N_vert() times
+        /// \details attempts to do single spins updates N_vert() times, an
+        /// attempt only looks up the cached energy difference
         void step() {
             super::step();
-            auto const &con = super::get_state_connect();
 
-            auto &lat = super::prot_get_state();
-            for(uint i = 0; i < lat.size(); ++i) {
+            auto const n = super::get_state().size();
+            for(uint i = 0; i < n; ++i) {
                 // generate random position
                 uint pos = pos_();
-                // generate energy differece if swapped
-                double E_diff = 0;
-                for(auto const &iact : con[pos]) {
-                    bool same = iact->vert_vec.size() % 2;
-                    for(auto const &e : iact->vert_vec) {
-                        same ^= lat[e];
-                    }
-                    if(not same)
-                        E_diff += iact->weight;
-                    else
-                        E_diff -= iact->weight;
-                }
                 // swap-decision
-                if(accept_(E_diff)) {
-                    lat[pos] = !lat[pos];
-                    maxcut_ -= E_diff;
-                    energy_ += 2 * E_diff;
-                }
+                if(accept_(ediff_[pos])) flip_(pos);
             }
         }
 
@@ -127,17 +183,56 @@ namespace algo {    // documented in algo.hpp
                 // recalc lookup-table
                 for(uint i = 0; i < accept_cache_.size(); ++i) {
                     double const k = 1;
-                    double const E_diff = i;
+                    double const E_diff = i * bin_width_;
                     double const expo = E_diff / (k * T_);
                     accept_cache_[i] = std::exp(-expo);
                 }
             }
         }
+        /// \brief swaps the configuration and the cached energy differences
+        /// with the grid \p g of the same type
+        template <typename G>
+        void swap_state(G &g) {
+            super::swap_state(g);
+            auto &b = static_cast<simulated_anealing &>(g);
+            std::swap(energy_, b.energy_);
+            std::swap(maxcut_, b.maxcut_);
+            std::swap(sign_, b.sign_);
+            std::swap(ediff_, b.ediff_);
+        }
+        /// \brief copies the configuration and the cached energy differences
+        /// of the grid \p g of the same type into the own buffers
+        template <typename G>
+        void copy_state(G const &g) {
+            super::copy_state(g);
+            auto const &b = static_cast<simulated_anealing const &>(g);
+            energy_ = b.energy_;
+            maxcut_ = b.maxcut_;
+            sign_ = b.sign_;
+            ediff_ = b.ediff_;
+        }
         /*==== const methods ====*/
         /// \brief get the current energy
         double const &energy() const { return energy_; }
         /// \brief get the current maxcut
         double const &maxcut() const { return maxcut_; }
+        /// \brief logarithm of the (unnormalized) Boltzmann weight of the
+        /// configuration at the current temperature, i.e.
+        /// -energy() / (2 T), see exchange_log_ratio()
+        double log_weight() const {
+            return -energy_ / (2 * super::temperature());
+        }
+        /// \brief logarithm of the Metropolis ratio of exchanging the
+        /// configurations with the grid \p g of the same type, that may run
+        /// at another temperature
+        /// \details The chain samples exp(-energy() / (2 T)), since the
+        /// energy difference of a flip is half the change of energy().
+        template <typename G>
+        double exchange_log_ratio(G const &g) const {
+            auto const &b = static_cast<simulated_anealing const &>(g);
+            return (1 / super::temperature() - 1 / b.super::temperature()) *
+                   (energy_ - b.energy_) / 2;
+        }
 
         /// \brief print the super and then some information about the module
         void print() {
@@ -149,21 +244,52 @@ namespace algo {    // documented in algo.hpp
         }
 
     private:
+        // flips spin pos and updates the energy difference of all spins that
+        // share an interaction with it
+        void flip_(size_type const &pos) {
+            auto const &con = super::get_state_connect();
+            auto &lat = super::prot_get_state();
+
+            double const E_diff = ediff_[pos];
+            lat[pos] = !lat[pos];
+            maxcut_ -= E_diff;
+            energy_ += 2 * E_diff;
+
+            for(size_type k = 0; k < con[pos].size(); ++k) {
+                auto const &iact = con[pos][k];
+                auto &s = sign_[iact_id_[pos][k]];
+                double const c = 2 * (s ? iact->weight : -iact->weight);
+                s = not s;
+                for(auto const &e : iact->vert_vec) ediff_[e] -= c;
+            }
+        }
+
+        // the table brackets exp(-E_diff / T) between the bin edges, the exact
+        // value is only needed if the random number falls in between
         inline bool accept_(double const &E_diff) {
-            if(E_diff <= 0)
-                return true;
-            else if(accept_cache_[E_diff] > prob_())
-                return true;
+            if(E_diff <= 0) return true;
 
-            return false;
+            double const x = E_diff / bin_width_;
+            auto const bin = static_cast<size_type>(x);
+            double const u = prob_();
+            if(bin + 1 >= accept_cache_.size())
+                return std::exp(-E_diff / T_) > u;
+            if(accept_cache_[bin] <= u) return false;
+            if(x == bin or accept_cache_[bin + 1] > u) return true;
+            return std::exp(-E_diff / T_) > u;
         }
 
     private:
         temp_type T_;
         state_type sol_;
-        std::vector<double> accept_cache_;
+        size_type accept_bins_;
+        std::vector<double> accept_cache_;  // exp(-i * bin_width_ / T_)
+        double bin_width_;                  // power of two
         weight_type energy_;
         weight_type maxcut_;
+        std::vector<char> sign_;     // per interaction, see init()
+        std::vector<std::vector<size_type>> iact_id_;  // sign_ of con[i][k]
+        std::vector<double> ediff_;  // energy difference if flipped
         util::rng_class<size_type> pos_;
         util::rng_class<double> prob_;
     };
@@ -28,13 +28,23 @@
 #define SIQUAN_ALGO_SIMULATED_QUANTUM_ANEALING_HPP_GUARD
 
 #include "legacy/fastmath.hpp"
-#include "legacy/randombits.hpp"
+#include "simd.hpp"
 
 #include <fsc/stdSupport.hpp>
 
+#include "../tools/bernoulli_bits.hpp"
 #include "../tools/random.hpp"
+#include "../tools/serialize.hpp"
+#include "../types/aligned_allocator.hpp"
+#include "../types/energy.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace siquan {  // documented in base.hpp
@@ -60,14 +70,51 @@ namespace algo {    // documented in algo.hpp
         return get_interaction_contribution(s_i, field_stren);
     }
 
+    /// \cond IMPLEMENTATION_DETAIL_DOC
+    namespace detail {
+        // T::max_order if the type_carrier states it, 0 (any order) otherwise
+        template <typename T, typename = void>
+        struct max_order : std::integral_constant<int, 0> {};
+        template <typename T>
+        struct max_order<T, decltype(void(T::max_order))>
+            : std::integral_constant<int, T::max_order> {};
+
+        template <typename...>
+        struct voider {
+            using type = void;
+        };
+        // T::energy_type if the type_carrier states it, double otherwise
+        template <typename T, typename = void>
+        struct energy_type {
+            using type = double;
+        };
+        template <typename T>
+        struct energy_type<T,
+                           typename voider<typename T::energy_type>::type> {
+            using type = typename T::energy_type;
+        };
+    }  // end namespace detail
+    /// \endcond
+
     /// \brief This module provides a bit coded simulated quantum annealing
     /// implementation
+    /// \details 2-body interactions are kept as CSR adjacency (neighbour and
+    /// weight), higher orders in the generic pointer lists. If the
+    /// type_carrier declares <tt>static constexpr int max_order = 2</tt>, the
+    /// generic path is dropped and init() throws on higher orders.
+    /// The local energies use the optional \p energy_type of the type_carrier
+    /// (\p double, \p float or \p int32_t fixed point, see types::energy.hpp).
     /// \tparam super is the parent module which needs to provide the types
-    /// \p state_type and \p size_type
+    /// \p state_type, \p size_type and \p rng_type (a 32 or 64 bit random
+    /// engine, e.g. \p std::mt19937 or util::xoshiro256ss)
     template <typename super>
     class simulated_quantum_anealing : public super {
         using s_param = typename super::param;
         using trotter_line_type = typename super::state_type::value_type;
+        using rng_type = typename super::rng_type;
+        using energy_type = typename detail::energy_type<super>::type;
+        using energy_traits = types::energy_traits<energy_type>;
+        using sum_type = typename energy_traits::sum_type;
 
     public:
         /*==using declarations===*/
@@ -78,20 +125,47 @@ namespace algo {    // documented in algo.hpp
         struct param : public s_param {
             bool periodic;
             ///< specifies if the world-lines should periodic (1) or not (0)
-
-            /// \brief dumps \p periodic to \p "periodic" in the map \p m
+            uint32_t threads;
+            ///< threads of the sweep, more than 1 colours the spins (the
+            ///< result depends on the amount, not on the scheduling)
+            uint32_t time_blocks;
+            ///< threads per spin, more than 1 splits the slices into
+            ///< contiguous blocks of words (excludes \p threads > 1)
+            uint32_t converge;
+            ///< stop after this many steps without a new lowest slice energy
+            ///< (0: never)
+            double converge_from;
+            ///< fraction of the steps before the steps without a new lowest
+            ///< slice energy are counted, s.t. the low field phase is reached
+
+            /// \brief dumps \p periodic to \p "periodic", \p threads to
+            /// \p "threads", \p time_blocks to \p "time_blocks",
+            /// \p converge to \p "converge" and \p converge_from to
+            /// \p "converge_from" in the map \p m
             /// \param m \p std::map<std::string, std::string> like instance.
             template <typename M>
             void to_map(M &m) const {
                 s_param::to_map(m);
                 m["periodic"] = std::to_string(periodic);
+                m["threads"] = std::to_string(threads);
+                m["time_blocks"] = std::to_string(time_blocks);
+                m["converge"] = std::to_string(converge);
+                m["converge_from"] = std::to_string(converge_from);
             }
-            /// \brief loads "periodic" from the map \p m into \p periodic
+            /// \brief loads "periodic", "threads", "time_blocks", "converge"
+            /// and "converge_from" from the map \p m into \p periodic,
+            /// \p threads, \p time_blocks, \p converge and \p converge_from
             /// \param m \p std::map<std::string, std::string> like instance.
             template <typename M>
             void from_map(M const &m) {
                 s_param::from_map(m);
                 periodic = fsc::sto<int>(fsc::get(m, "periodic", "1"));
+                threads = fsc::sto<uint32_t>(fsc::get(m, "threads", "1"));
+                time_blocks =
+                    fsc::sto<uint32_t>(fsc::get(m, "time_blocks", "1"));
+                converge = fsc::sto<uint32_t>(fsc::get(m, "converge", "0"));
+                converge_from =
+                    fsc::sto<double>(fsc::get(m, "converge_from", "0.5"));
             }
         };
 
@@ -100,12 +174,38 @@ namespace algo {    // documented in algo.hpp
         /// \param p constructor argument for super and seeds own RNGs
         simulated_quantum_anealing(param const &p)
             : super(p),
+              ener_(),
+              ener_stride_(0),
+              slice_energy_(),
               NT(super::get_nt()),
-              bit_distribution(),
-              drand(0, 1),
-              formed_clusters(NT),
-              updates(NT) {
-            rnd32_generator.seed(p.seed_rng());
+              periodic_(p.periodic),
+              time_blocks_(std::max(p.time_blocks, uint32_t(1))),
+              converge_(p.converge),
+              converge_from_(p.converge_from * super::steps()),
+              sweeps_(0),
+              idle_(0),
+              lowest_(std::numeric_limits<double>::infinity()),
+              tol_(0),
+              workers_() {
+            if(p.threads > 1 and time_blocks_ > 1)
+                throw std::runtime_error(
+                    "simulated_quantum_anealing: threads and time_blocks "
+                    "cannot both be above 1");
+            // one set of streams per thread, the first one is seeded as for
+            // a serial run
+            auto const n_workers = std::max(p.threads, time_blocks_);
+            auto const n_words = (NT + 63) / 64;
+            for(uint32_t t = 0; t < n_workers; ++t) {
+                workers_.emplace_back(NT);
+                auto &w = workers_.back();
+                w.rnd_generator.seed(p.seed_rng());
+                w.bit_distribution.seed(p.seed_rng());
+                // the slices of block t, empty if there are too few words
+                w.w_begin = n_words * t / n_workers;
+                w.w_end = n_words * (t + 1) / n_workers;
+                w.s_begin = std::min<uint32_t>(64 * w.w_begin, NT);
+                w.s_end = std::min<uint32_t>(64 * w.w_end, NT);
+            }
             get_rel_orientation_first_block =
                 p.periodic
                     ? &simulated_quantum_anealing::rel_orientation_periodic
@@ -117,16 +217,28 @@ namespace algo {    // documented in algo.hpp
         void init() {
             super::init();
 
-            ener_.resize(super::n_vert(),
-                         typename decltype(ener_)::value_type(NT));
+            // one cache line aligned row per spin, padded to whole lines
+            ener_stride_ =
+                types::round_up(NT, types::cache_line / sizeof(energy_type));
+            ener_.assign(super::n_vert() * ener_stride_, energy_type(0));
+            slice_energy_.assign(NT, sum_type(0));
+            for(auto &w : workers_) w.slice_change.assign(NT, sum_type(0));
+            sweeps_ = 0;
+            idle_ = 0;
+            lowest_ = std::numeric_limits<double>::infinity();
+            tol_ = 0;
+            // couplings of slice ts by order, every interaction is listed
+            // once per vertex, i.e. order times
+            std::vector<std::vector<sum_type>> listed;
 
             auto &lat = super::prot_get_state();
             auto &con = super::prot_get_state_connect();
 
             std::mt19937_64 random(
-                rnd32_generator());  // fixme: maybe use a distribution to
-                                     // get a random int with a suitable
-                                     // nr of bits...
+                workers_[0].rnd_generator());  // fixme: maybe use a
+                                               // distribution to get a
+                                               // random int with a
+                                               // suitable nr of bits...
             for(size_t idx = 0; idx < super::n_vert(); ++idx) {
                 uint64_t l = 0;
                 uint64_t r = 0;
@@ -156,71 +268,94 @@ namespace algo {    // documented in algo.hpp
                     h_field = (*it)->weight;
                     con[idx].erase(it);
                 }
+                // every contribution is converted on its own, s.t. the
+                // updates by twice the converted weight stay consistent
+                double abs_sum = std::abs(h_field);
+                for(auto const &iptr : con[idx])
+                    abs_sum += std::abs(iptr->weight);
+                tol_ += 1e-9 * abs_sum;
+                if(abs_sum > energy_traits::max_local())
+                    throw std::runtime_error(
+                        "simulated_quantum_anealing: local energy too large "
+                        "for energy_type");
+
+                energy_type *ener = ener_row_(idx);
                 for(size_t ts = 0; ts < NT; ++ts) {  // for all trotter slides
-                    ener_[idx][ts] = get_field_contribution(site[ts], h_field);
+                    ener[ts] = energy_traits::from_double(
+                        get_field_contribution(site[ts], h_field));
+                    slice_energy_[ts] += ener[ts];
 
                     for(size_t i = 0; i < con[idx].size();
                         ++i) {  // for all interactions
-                        ener_[idx][ts] += get_coupling(con[idx][i], ts);
+                        auto const &vv = con[idx][i]->vert_vec;
+                        energy_type const coupling = energy_traits::from_double(
+                            get_coupling(con[idx][i], ts));
+                        // a self coupling (i, i) is constant, it only counts
+                        // for the energy of the slice
+                        if(vv.size() != 2 or vv[0] != vv[1])
+                            ener[ts] += coupling;
+                        auto const order = vv.size();
+                        if(listed.size() <= order)
+                            listed.resize(order + 1,
+                                          std::vector<sum_type>(NT, 0));
+                        listed[order][ts] += coupling;
+                    }
+                }
+            }
+            for(size_type order = 1; order < listed.size(); ++order)
+                for(size_t ts = 0; ts < NT; ++ts)
+                    slice_energy_[ts] += listed[order][ts] / sum_type(order);
+            // move the 2-body interactions to the CSR adjacency, the weights
+            // are constant from here on
+            pair_begin_.assign(1, 0);
+            pair_.clear();
+            for(uint32_t idx = 0; idx < super::n_vert(); ++idx) {
+                for(auto const &iptr : con[idx]) {
+                    auto const &vv = iptr->vert_vec;
+                    if(vv.size() == 2) {
+                        // a self coupling (i, i) is constant
+                        if(vv[0] != vv[1])
+                            pair_.push_back({vv[0] == idx ? vv[1] : vv[0],
+                                             twice_(iptr->weight)});
+                    } else if(quadratic) {
+                        throw std::runtime_error(
+                            "simulated_quantum_anealing: interaction order "
+                            "above max_order = 2");
                     }
                 }
+                pair_begin_.push_back(pair_.size());
+                con[idx].erase(
+                    std::remove_if(con[idx].begin(), con[idx].end(),
+                                   [](auto const &iptr) {
+                                       return iptr->vert_vec.size() == 2;
+                                   }),
+                    con[idx].end());
             }
+            colors_.clear();
+            if(workers_.size() > 1 and time_blocks_ == 1) color_spins_();
         }
 
         /// \brief advances the state of the super and then the module's state
-        /// \details attempts to do cluster updates over the whole state
+        /// \details attempts to do cluster updates over the whole state and,
+        /// after \p converge_from of the steps, counts the steps without a
+        /// new lowest slice energy (O(nt))
         void step() {
             super::step();
-            //~ MIB_START("step_cluster")
-
-            auto &lat = super::prot_get_state();
-
-            for(size_type i = 0; i < lat.size(); ++i) {
-                auto &site = lat[i];
-                // form_bonds
-                form_bonds(site);
-                // breaks
-                auto breaks = formed_clusters.begin();
-                auto first_break = *breaks;
-                auto last_break = first_break;
-                ++breaks;  // here a dumb operator++ would be better maybe
-
-                // while
-                for(; breaks != formed_clusters.end(); ++breaks) {
-                    // calculate h-field energy of the cluster if flipped
-                    // (B in AAAABAAA)
-                    double energy_difference =
-                        std::accumulate(ener_[i].begin() + last_break,
-                                        ener_[i].begin() + *breaks, 0.);
-                    //~ std::cout << "Ediff1: " << energy_difference  << " f "
-                    //<< last_break << "/" << *breaks << std::endl;
-                    // energy sign here
-                    if(drand(rnd32_generator) <= fexp(energy_difference)) {
-                        add_spins_to_update(last_break, *breaks);
-                    }
-                    last_break = *breaks;  // index, at which cluster starts
-                }
-                // Ediff
-                // calc the opposite energy of the trotter line (A in AAAABAAA)
-                // and flip it
-                double energy_difference =
-                    std::accumulate(ener_[i].begin(),
-                                    ener_[i].begin() + first_break, 0.) +
-                    std::accumulate(ener_[i].begin() + last_break,
-                                    ener_[i].end(), 0.);
-                //~ std::cout << "Ediff2: " << energy_difference << " g " <<
-                // last_break << "/" << first_break << std::endl;
-                // energy sign here
-                if(drand(rnd32_generator) <= fexp(energy_difference)) {
-                    add_spins_to_update(last_break, *formed_clusters.end());
-                    add_spins_to_update(0, first_break);
-                }
-                // update_site
-                update_site(site, i);
-                updates.reset();
-            }
-            //~ std::cout << lat << std::endl;
-            //~ MIB_STOP("step_cluster")
+            sweep_();
+            ++sweeps_;
+
+            // the lowest slice energy of the high field phase is not tracked,
+            // the slices still disagree there and it improves by chance only
+            if(converge_ == 0 or sweeps_ <= converge_from_) return;
+            sum_type low = slice_total_(0);
+            for(size_type ts = 1; ts < NT; ++ts)
+                low = std::min(low, slice_total_(ts));
+            double const e = energy_traits::to_double(low);
+            if(e < lowest_ - tol_) {
+                lowest_ = e;
+                idle_ = 0;
+            } else
+                ++idle_;
         }
 
         /// \brief updates the super and gets the new state of the schedulers
@@ -232,12 +367,173 @@ namespace algo {    // documented in algo.hpp
                                             // energy difference ener is
                                             // saved and updated
             // probability for cluster breakup
-            bit_distribution.param(
-                tanh(tau * std::abs(super::transverse_field())));
+            for(auto &w : workers_)
+                w.bit_distribution.param(
+                    tanh(tau * std::abs(super::transverse_field())));
+        }
+        /// \brief swaps the configuration and the local energies with the
+        /// grid \p g of the same type
+        template <typename G>
+        void swap_state(G &g) {
+            super::swap_state(g);
+            auto &b = static_cast<simulated_quantum_anealing &>(g);
+            fold_();
+            b.fold_();
+            std::swap(slice_energy_, b.slice_energy_);
+            std::swap(ener_, b.ener_);
+        }
+        /// \brief copies the configuration and the local energies of the
+        /// grid \p g of the same type into the own buffers
+        template <typename G>
+        void copy_state(G const &g) {
+            super::copy_state(g);
+            auto const &b = static_cast<simulated_quantum_anealing const &>(g);
+            for(size_type ts = 0; ts < NT; ++ts)
+                slice_energy_[ts] = b.slice_total_(ts);
+            for(auto &w : workers_)
+                std::fill(w.slice_change.begin(), w.slice_change.end(), 0);
+            ener_ = b.ener_;
+        }
+        /// \brief writes the super, then the local energies, the slice
+        /// energies and the random streams to \p s
+        /// \details the derived buffers (bonds, colours, fexp) are rebuilt by
+        /// init() and update(), i.e. load_state() belongs between them
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, ener_);
+            util::write(s, slice_energy_);
+            for(auto const &w : workers_) {
+                util::write(s, w.slice_change);
+                util::write(s, w.rnd_generator);
+                util::write(s, w.bit_distribution);
+                util::write(s, w.drand);
+            }
+            util::write(s, sweeps_);
+            util::write(s, idle_);
+            util::write(s, lowest_);
+        }
+        /// \brief reads the super and then the own state written by
+        /// save_state() from \p s
+        /// \pre init() was called with the same parameters
+        /// \throws std::runtime_error if \p s holds another size
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            auto const n = ener_.size();
+            util::read(s, ener_);
+            util::read(s, slice_energy_);
+            if(ener_.size() != n or slice_energy_.size() != NT)
+                throw std::runtime_error(
+                    "simulated_quantum_anealing: checkpoint of another size");
+            for(auto &w : workers_) {
+                util::read(s, w.slice_change);
+                util::read(s, w.rnd_generator);
+                util::read(s, w.bit_distribution);
+                util::read(s, w.drand);
+            }
+            util::read(s, sweeps_);
+            util::read(s, idle_);
+            util::read(s, lowest_);
         }
         /*==== const methods ====*/
+        /// \brief stops if super stops or if converged()
+        bool stop() const { return converged() or super::stop(); }
+        /// \brief true if \p converge > 0 and the lowest slice energy since
+        /// \p converge_from of the steps did not improve (by more than 1e-9
+        /// times the absolute weights) during the last \p converge steps
+        /// \details the lowest slice energy is only tracked once the field is
+        /// low, i.e. in the late phase where the slices agree and clusters
+        /// hardly flip
+        bool converged() const { return converge_ > 0 and idle_ >= converge_; }
+        /// \brief get the amount of steps done so far
+        size_type const &sweeps() const { return sweeps_; }
         /// \brief what we refer to a up spin
         int spin_up() const { return 0; }
+        /// \brief get the classical energy of every slice in O(nt)
+        /// \details tracked during the updates, in the units of the weights
+        /// the module works with (see connect::normalize_weight). Exact for
+        /// the fixed point energy_type, the \p float one drifts like the
+        /// local energies.
+        std::vector<double> slice_energies() const {
+            std::vector<double> res(NT);
+            for(size_type ts = 0; ts < NT; ++ts)
+                res[ts] = energy_traits::to_double(slice_total_(ts));
+            return res;
+        }
+        /// \brief get the sum of the classical energies of all slices
+        /// \details see slice_energies()
+        double energy_sum() const {
+            sum_type res = 0;
+            for(size_type ts = 0; ts < NT; ++ts) res += slice_total_(ts);
+            return energy_traits::to_double(res);
+        }
+        /// \brief get the amount of neighbouring slices (the last and the
+        /// first one if periodic) that are not aligned
+        size_type broken_bonds() const {
+            auto const &lat = super::get_state();
+            size_type const n_words = (NT + 63) / 64;
+            size_type res = 0;
+            for(auto const &site : lat) {
+                for(size_type k = 0; k < n_words; ++k) {
+                    uint64_t rel = rel_word_(site, k);
+                    if(64 * k + 64 > NT)  // clear bits behind the last slice
+                        rel &= (uint64_t(1) << (NT - 64 * k)) - 1;
+                    res += __builtin_popcountll(rel);
+                }
+                res -= not periodic_;  // slice 0 has no left neighbour
+            }
+            return res;
+        }
+        /// \brief logarithm of the weight of the configuration at the current
+        /// temperature and transverse field
+        /// \details Every pair of neighbouring slices contributes
+        /// log(cosh(tau * H)) if aligned and log(sinh(tau * H)) if not, the
+        /// slices exp(-tau * E).
+        double log_weight() const {
+            double const x = tau_() * std::abs(super::transverse_field());
+            double const n_bonds =
+                double(super::n_vert()) * (periodic_ ? NT : NT - 1);
+            double const broken = broken_bonds();
+            // log(cosh(x)) without overflow
+            double res = -tau_() * energy_sum() +
+                         n_bonds * (x + std::log1p(std::exp(-2 * x)) -
+                                    std::log(2.));
+            if(broken > 0) res += broken * std::log(std::tanh(x));
+            return res;
+        }
+        /// \brief logarithm of the Metropolis ratio of exchanging the
+        /// configurations with the grid \p g of the same type, that may run
+        /// at another temperature and/or transverse field
+        /// \details With tau = beta / nt and the coupling jperp =
+        /// -log(tanh(tau * H)) / 2 of neighbouring slices, the ratio is
+        /// (tau_a - tau_b) (E_a - E_b) + 2 (jperp_a - jperp_b) (B_a - B_b)
+        /// for the energy_sum() E and the broken_bonds() B.
+        template <typename G>
+        double exchange_log_ratio(G const &g) const {
+            auto const &b = static_cast<simulated_quantum_anealing const &>(g);
+            double res = (tau_() - b.tau_()) * (energy_sum() - b.energy_sum());
+            double const ja = jperp_();
+            double const jb = b.jperp_();
+            if(ja != jb) {  // both infinite without field
+                double const ba = broken_bonds();
+                double const bb = b.broken_bonds();
+                if(ba != bb) res += 2 * (ja - jb) * (ba - bb);
+            }
+            return res;
+        }
+
+        /// \brief dumps \p sweeps to \p "stop_step" and \p converged to
+        /// \p "converged" in the map \p m if \p converge > 0
+        /// \param m \p std::map<std::string, std::string> like instance.
+        template <typename M>
+        void to_map(M &m) const {
+            super::to_map(m);
+            if(converge_ > 0) {
+                m["stop_step"] = std::to_string(sweeps());
+                m["converged"] = std::to_string(converged());
+            }
+        }
 
         /// \brief print information about super, then of the own module
         void print() {
@@ -249,6 +545,299 @@ namespace algo {    // documented in algo.hpp
         }
 
     private:
+        // scratch space and random streams of one thread of the sweep
+        struct worker_type {
+            worker_type(uint32_t const &nt)
+                : bit_distribution(),
+                  drand(0, 1),
+                  formed_clusters(nt),
+                  updates(nt),
+                  ener_sum_(nt + 1),
+                  slice_change(nt, 0) {}
+
+            util::bernoulli_bits<> bit_distribution;  // own lane engine
+            std::uniform_real_distribution<double> drand;
+            trotter_line_type formed_clusters;
+            trotter_line_type updates;
+            std::vector<sum_type> ener_sum_;  // prefix sum of ener_ of a site
+            // of the energy of every slice since the last fold_()
+            std::vector<sum_type> slice_change;
+            rng_type rnd_generator;  // feeds bonds and cluster flips
+            // own block of the time_blocks mode: words [w_begin, w_end),
+            // slices [s_begin, s_end) and its first and last break (NT: none)
+            size_type w_begin, w_end;
+            uint32_t s_begin, s_end, first, last;
+        };
+
+        // cluster updates of all spins, see step()
+        void sweep_() {
+            //~ MIB_START("step_cluster")
+
+            auto &lat = super::prot_get_state();
+
+            if(time_blocks_ > 1) {
+                for(size_type i = 0; i < lat.size(); ++i) sweep_site_blocks_(i);
+                return;
+            }
+            if(colors_.empty()) {
+                for(size_type i = 0; i < lat.size(); ++i)
+                    sweep_site_(i, workers_[0]);
+                return;
+            }
+            // the spins of one colour do not interfere, the class is split
+            // into one fixed chunk per worker
+            int const n_workers = static_cast<int>(workers_.size());
+            for(auto const &cls : colors_) {
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n_workers) schedule(static, 1)
+#endif
+                for(int t = 0; t < n_workers; ++t) {
+                    size_type const b = cls.size() * t / n_workers;
+                    size_type const e = cls.size() * (t + 1) / n_workers;
+                    for(size_type k = b; k < e; ++k)
+                        sweep_site_(cls[k], workers_[t]);
+                }
+            }
+        }
+
+        // cluster update of all slices of spin i
+        void sweep_site_(size_type const &i, worker_type &w) {
+            auto &site = super::prot_get_state()[i];
+            auto &ener_sum_ = w.ener_sum_;
+            // form_bonds
+            form_bonds(site, w);
+            // prefix sum of the local energies, s.t. the energy of every
+            // cluster is the difference of two entries
+            energy_type const *ener = ener_row_(i);
+            sum_type acc = 0;
+            ener_sum_[0] = acc;
+            for(size_type ts = 0; ts < NT; ++ts)
+                ener_sum_[ts + 1] = acc += ener[ts];
+            // breaks
+            auto breaks = w.formed_clusters.begin();
+            auto first_break = *breaks;
+            auto last_break = first_break;
+            ++breaks;  // here a dumb operator++ would be better maybe
+
+            // while
+            for(; breaks != w.formed_clusters.end(); ++breaks) {
+                // calculate h-field energy of the cluster if flipped
+                // (B in AAAABAAA)
+                sum_type energy_difference =
+                    ener_sum_[*breaks] - ener_sum_[last_break];
+                // energy sign here
+                if(w.drand(w.rnd_generator) <=
+                   fexp(energy_traits::to_double(energy_difference))) {
+                    add_spins_to_update(last_break, *breaks, w);
+                }
+                last_break = *breaks;  // index, at which cluster starts
+            }
+            // Ediff
+            // calc the opposite energy of the trotter line (A in AAAABAAA)
+            // and flip it
+            sum_type energy_difference = ener_sum_[first_break] +
+                                         ener_sum_[NT] - ener_sum_[last_break];
+            // energy sign here
+            if(w.drand(w.rnd_generator) <=
+               fexp(energy_traits::to_double(energy_difference))) {
+                add_spins_to_update(last_break, NT, w);
+                add_spins_to_update(0, first_break, w);
+            }
+            // update_site
+            update_site(site, i, w);
+            w.updates.reset();
+        }
+
+        // cluster update of all slices of spin i, every worker walks the
+        // clusters within its block, the ones across the block boundaries
+        // are decided afterwards in stitch_blocks_
+        void sweep_site_blocks_(size_type const &i) {
+            auto &site = super::prot_get_state()[i];
+            int const n_blocks = static_cast<int>(workers_.size());
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n_blocks) schedule(static, 1)
+#endif
+            for(int b = 0; b < n_blocks; ++b)
+                walk_block_(site, i, workers_[b]);
+
+            stitch_blocks_();
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n_blocks) schedule(static, 1)
+#endif
+            for(int b = 0; b < n_blocks; ++b) {
+                update_block_(site, i, workers_[b]);
+                workers_[b].updates.reset();
+            }
+        }
+
+        // word k of the relative orientation, bit ts is set if slice ts
+        // differs from slice ts - 1 (see rel_orientation_periodic)
+        uint64_t rel_word_(trotter_line_type const &site,
+                           size_type const &k) const {
+            uint64_t const s = site.word(k);
+            uint64_t carry = 0;
+            if(k > 0)
+                carry = site.word(k - 1) >> 63;
+            else
+                carry = periodic_ ? uint64_t(site[NT - 1]) : (~s & 1);
+            return s ^ ((s << 1) | carry);
+        }
+
+        // forms the bonds of the block of w, accumulates its energies and
+        // decides the clusters between its first and last break
+        void walk_block_(trotter_line_type const &site, size_type const &i,
+                         worker_type &w) {
+            auto &ener_sum_ = w.ener_sum_;
+            energy_type const *ener = ener_row_(i);
+            sum_type acc = 0;
+            ener_sum_[w.s_begin] = acc;
+            for(size_type ts = w.s_begin; ts < w.s_end; ++ts)
+                ener_sum_[ts + 1] = acc += ener[ts];
+
+            w.first = w.last = NT;
+            for(size_type k = w.w_begin; k < w.w_end; ++k) {
+                uint64_t bonds = w.bit_distribution() | rel_word_(site, k);
+                if(64 * k + 64 > NT)  // clear bits behind the last slice
+                    bonds &= (uint64_t(1) << (NT - 64 * k)) - 1;
+                for(; bonds; bonds &= bonds - 1) {
+                    uint32_t const ts = 64 * k + __builtin_ctzll(bonds);
+                    if(w.last == NT) {
+                        w.first = ts;
+                    } else {
+                        sum_type energy_difference =
+                            ener_sum_[ts] - ener_sum_[w.last];
+                        if(w.drand(w.rnd_generator) <=
+                           fexp(energy_traits::to_double(energy_difference)))
+                            add_spins_to_update(w.last, ts, w);
+                    }
+                    w.last = ts;
+                }
+            }
+        }
+
+        // decides the clusters that reach over block boundaries, block by
+        // block with the streams of the first worker
+        void stitch_blocks_() {
+            size_type const n = workers_.size();
+            auto &w0 = workers_[0];
+            auto total = [](worker_type const &w) {
+                return w.ener_sum_[w.s_end] - w.ener_sum_[w.s_begin];
+            };
+            auto accept = [&](sum_type const &energy_difference) {
+                return w0.drand(w0.rnd_generator) <=
+                       fexp(energy_traits::to_double(energy_difference));
+            };
+
+            size_type first = 0;
+            while(first < n and workers_[first].first == NT) ++first;
+            if(first == n) {  // no break at all, the line is one cluster
+                sum_type energy_difference = 0;
+                for(auto const &w : workers_) energy_difference += total(w);
+                if(accept(energy_difference))
+                    for(auto &w : workers_)
+                        add_spins_to_update(w.s_begin, w.s_end, w);
+                return;
+            }
+            // from the last break of block b to the first break of the next
+            // block c with breaks, wrapping around at the end
+            size_type b = first;
+            do {
+                auto &wb = workers_[b];
+                sum_type energy_difference =
+                    wb.ener_sum_[wb.s_end] - wb.ener_sum_[wb.last];
+                size_type c = (b + 1) % n;
+                for(; workers_[c].first == NT; c = (c + 1) % n)
+                    energy_difference += total(workers_[c]);
+                auto &wc = workers_[c];
+                energy_difference +=
+                    wc.ener_sum_[wc.first] - wc.ener_sum_[wc.s_begin];
+
+                if(accept(energy_difference)) {
+                    add_spins_to_update(wb.last, wb.s_end, wb);
+                    for(size_type d = (b + 1) % n; d != c; d = (d + 1) % n)
+                        add_spins_to_update(workers_[d].s_begin,
+                                            workers_[d].s_end, workers_[d]);
+                    add_spins_to_update(wc.s_begin, wc.first, wc);
+                }
+                b = c;
+            } while(b != first);
+        }
+
+        // update_site restricted to the words of the block of w
+        void update_block_(trotter_line_type &site, size_type const &idx,
+                           worker_type &w) {
+            auto const &con = super::get_state_connect();
+            auto const &lat = super::get_state();
+
+            for(size_type k = w.w_begin; k < w.w_end; ++k) {
+                uint64_t const u = w.updates.word(k);
+                if(u == 0) continue;
+                auto const n = std::min<size_type>(64, NT - 64 * k);
+                uint64_t const s = site.word(k);
+
+                for(size_type j = pair_begin_[idx]; j < pair_begin_[idx + 1];
+                    ++j) {
+                    auto const &e = pair_[j];
+                    simd::update_energy_word(ener_row_(e.nb) + 64 * k, u,
+                                             s ^ lat[e.nb].word(k), e.weight2,
+                                             n);
+                }
+                if(not quadratic) {
+                    for(auto const &iptr : con[idx]) {
+                        uint64_t alignment = 0;
+                        for(auto const &nb : iptr->vert_vec)
+                            alignment ^= lat[nb].word(k);
+                        for(auto const &nb : iptr->vert_vec) {
+                            if(nb == idx) continue;
+                            simd::update_energy_word(ener_row_(nb) + 64 * k,
+                                                     u, alignment,
+                                                     twice_(iptr->weight), n);
+                        }
+                    }
+                }
+            }
+            // own slices of the site
+            energy_type *ener = ener_row_(idx);
+            for(auto const &ts : w.updates) {
+                site.flip(ts);
+                w.slice_change[ts] -= 2 * sum_type(ener[ts]);
+                ener[ts] = -ener[ts];
+            }
+        }
+
+        // greedy distance-2 colouring: spins of one colour share neither an
+        // interaction nor a neighbour whose energies they both update
+        void color_spins_() {
+            auto const &con = super::get_state_connect();
+            size_type const n = super::n_vert();
+
+            std::vector<std::vector<uint32_t>> adj(n);
+            for(uint32_t idx = 0; idx < n; ++idx) {
+                for(size_type k = pair_begin_[idx]; k < pair_begin_[idx + 1];
+                    ++k)
+                    adj[idx].push_back(pair_[k].nb);
+                for(auto const &iptr : con[idx])
+                    for(auto const &nb : iptr->vert_vec)
+                        if(nb != idx) adj[idx].push_back(nb);
+            }
+
+            std::vector<size_type> color(n, n);  // n: not coloured yet
+            std::vector<size_type> seen(n + 1, n);  // colour -> last spin
+            colors_.clear();
+            for(uint32_t idx = 0; idx < n; ++idx) {
+                for(auto const &j : adj[idx]) {
+                    seen[color[j]] = idx;
+                    for(auto const &k : adj[j]) seen[color[k]] = idx;
+                }
+                size_type c = 0;
+                while(seen[c] == idx) ++c;
+                color[idx] = c;
+                if(c == colors_.size()) colors_.emplace_back();
+                colors_[c].push_back(idx);
+            }
+        }
+
         trotter_line_type rel_orientation_periodic(
             trotter_line_type const &spin_state) {
             auto temp = spin_state;
@@ -267,23 +856,18 @@ namespace algo {    // documented in algo.hpp
             return temp;
         }
 
-        void add_spins_to_update(size_t const &start, size_t const &end) {
+        void add_spins_to_update(size_t const &start, size_t const &end,
+                                 worker_type &w) {
             for(size_t i = start; i < end; ++i) {
                 assert(end <= NT);
-                updates.flip(i);
+                w.updates.flip(i);
             }
         }
 
-        void form_bonds(trotter_line_type const &spin_state) {
-            uint64_t r = 0;
-            for(size_t ts = 0; ts < NT; ++ts) {
-                if(ts % 64 == 0) {
-                    r = bit_distribution(rnd32_generator);
-                }
-
-                formed_clusters[ts] = r & 1;
-                r >>= 1;  // order?
-            }
+        void form_bonds(trotter_line_type const &spin_state, worker_type &w) {
+            auto &formed_clusters = w.formed_clusters;
+            // whole line of bonds, the words are generated blockwise
+            w.bit_distribution(formed_clusters);
             auto temp = (this->*get_rel_orientation_first_block)(spin_state);
 
             // frm       1100101 // rng with break_up_prob
@@ -295,45 +879,53 @@ namespace algo {    // documented in algo.hpp
             formed_clusters |= temp;
         }
 
-        void update_site(trotter_line_type &site, uint32_t const &idx) {
-            // update_nbr
-            // vec-alloc
-            trotter_line_type alignment(NT);
-
+        void update_site(trotter_line_type &site, size_type const &idx,
+                         worker_type &w) {
             auto const &con = super::get_state_connect();
             auto const &lat = super::get_state();
+            auto const &updates = w.updates;
+
+            // 2-body: the alignment is the xor of the two lines
+            for(size_type k = pair_begin_[idx]; k < pair_begin_[idx + 1];
+                ++k) {
+                auto const &e = pair_[k];
+                simd::update_energy(ener_row_(e.nb), updates, site, lat[e.nb],
+                                    e.weight2);
+            }
 
-            for(auto const &iptr : con[idx]) {  // for each interaction
-                // allign=0
-                alignment.reset();  // fixed it now since 1 is spin down
-
-                // xor
-                for(auto const &nb :
-                    iptr->vert_vec) {  // neighbors = spins that couple
-                    // get allignment for all trotter slides
-                    alignment ^= lat[nb];
-                    // todo: maybe save and update alignment (makes sense if a
-                    // lot of spins couple)
-                }
+            // higher orders, dropped if the type_carrier excludes them
+            if(not quadratic) {
+                // vec-alloc
+                trotter_line_type alignment(NT);
+                for(auto const &iptr : con[idx]) {  // for each interaction
+                    // allign=0
+                    alignment.reset();  // fixed it now since 1 is spin down
+
+                    // xor
+                    for(auto const &nb :
+                        iptr->vert_vec) {  // neighbors = spins that couple
+                        // get allignment for all trotter slides
+                        alignment ^= lat[nb];
+                    }
 
-                // moreup
-                for(auto const &nb : iptr->vert_vec) {
-                    if(nb == idx) continue;  // and update the energies up-nbr
-                    for(auto const &ts : updates)
-                        ener_[nb][ts] -= get_interaction_contribution(
-                            alignment[ts], 2 * iptr->weight);
+                    // moreup
+                    for(auto const &nb : iptr->vert_vec) {
+                        if(nb == idx)
+                            continue;  // and update the energies up-nbr
+                        simd::update_energy(ener_row_(nb), updates, alignment,
+                                            twice_(iptr->weight));
+                    }
                 }
             }
             // update state
             site ^= updates;
-            //~ std::transform(spin[site].state.begin(), spin[site].state.end(),
-            // updates.begin(), spin[site].state.begin(),
-            // std::bit_xor<base_type>());
 
             // h-field?
             // flip energy if updated?!
-            for(uint32_t ts = 0; ts < NT; ++ts) {
-                ener_[idx][ts] = updates[ts] ? -ener_[idx][ts] : ener_[idx][ts];
+            energy_type *ener = ener_row_(idx);
+            for(auto const &ts : updates) {
+                w.slice_change[ts] -= 2 * sum_type(ener[ts]);
+                ener[ts] = -ener[ts];
             }
         }
         template <typename iact_type>
@@ -348,24 +940,76 @@ namespace algo {    // documented in algo.hpp
         }
 
     private:
-        std::vector<std::vector<double>> ener_;
+        // neighbour and twice the weight of a 2-body interaction
+        struct pair_type {
+            uint32_t nb;
+            energy_type weight2;
+        };
+        static constexpr bool quadratic = detail::max_order<super>::value == 2;
+
+        // the local energies of spin i, padded to ener_stride_
+        energy_type *ener_row_(size_type const &i) noexcept {
+            return ener_.data() + i * ener_stride_;
+        }
+        // energy change of flipping a contribution of weight w
+        static energy_type twice_(double const &w) {
+            return 2 * energy_traits::from_double(w);
+        }
+        // energy of slice ts, the workers only track their changes, s.t.
+        // they never share a counter
+        sum_type slice_total_(size_type const &ts) const {
+            sum_type res = slice_energy_[ts];
+            for(auto const &w : workers_) res += w.slice_change[ts];
+            return res;
+        }
+        // moves the changes of the workers to slice_energy_
+        void fold_() {
+            for(auto &w : workers_)
+                for(size_type ts = 0; ts < NT; ++ts) {
+                    slice_energy_[ts] += w.slice_change[ts];
+                    w.slice_change[ts] = 0;
+                }
+        }
+        // beta / nt
+        double tau_() const { return 1 / (super::temperature() * NT); }
+        // coupling of neighbouring slices, infinite without field
+        double jperp_() const {
+            double const th =
+                std::tanh(tau_() * std::abs(super::transverse_field()));
+            return th > 0 ? -0.5 * std::log(th)
+                          : std::numeric_limits<double>::infinity();
+        }
+
+    private:
+        std::vector<energy_type, types::aligned_allocator<energy_type>> ener_;
+        size_type ener_stride_;  // distance of two spins in ener_
+        // slice_energies() without the changes of workers_
+        std::vector<sum_type> slice_energy_;
 
         const uint32_t NT;
-        Randombits<uint64_t> bit_distribution;
-        std::uniform_real_distribution<double> drand;
-        trotter_line_type formed_clusters;
-        trotter_line_type updates;
+        bool const periodic_;
+        uint32_t const time_blocks_;
+        uint32_t const converge_;
+        double const converge_from_;  // steps before idle_ is counted
+        size_type sweeps_;
+        size_type idle_;  // steps without a new lowest_
+        double lowest_;   // lowest slice energy so far
+        double tol_;      // of an improvement of lowest_
+        std::vector<worker_type> workers_;  // one per thread
+        std::vector<std::vector<uint32_t>> colors_;  // empty if serial
+        std::vector<size_type> pair_begin_;  // CSR row offsets into pair_
+        std::vector<pair_type> pair_;
         fastmath::exp<true, 12> fexp;  // 12: precision of error correction
         //~ slow_exp fexp;
-        mutable std::mt19937 rnd32_generator;  // 32 bit random ints, mersenne
-                                               // twister-> fixme: take
-                                               // something more efficient
 
         trotter_line_type (
             simulated_quantum_anealing::*get_rel_orientation_first_block)(
             trotter_line_type const &);
     };
 
+    template <typename super>
+    constexpr bool simulated_quantum_anealing<super>::quadratic;
+
 }  // end namespace algo
 }  // end namespace siquan
 
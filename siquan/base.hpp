@@ -53,6 +53,18 @@ struct base : public type_carrier {
     // connect/state
     /// \brief stops super::init calls, by not calling anything anymore.
     void init() {}
+    /// \brief stops super::swap_state calls, by not calling anything anymore.
+    template <typename G>
+    void swap_state(G &) {}
+    /// \brief stops super::copy_state calls, by not calling anything anymore.
+    template <typename G>
+    void copy_state(G const &) {}
+    /// \brief stops super::save_state calls, by not calling anything anymore.
+    template <typename S>
+    void save_state(S &) const {}
+    /// \brief stops super::load_state calls, by not calling anything anymore.
+    template <typename S>
+    void load_state(S &) {}
 
     // algo
     /// \brief stops super::update calls, by not calling anything anymore.
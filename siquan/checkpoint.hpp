@@ -0,0 +1,159 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/** \file
+ * \brief Checkpoints of a running simulation
+ * \details A checkpoint is a binary snapshot of everything a grid needs to
+ * continue bit-exactly: the configuration, the cached energies, the random
+ * streams, the step counters and the buffers of the observers. Every module
+ * writes its part in save_state() and reads it back in load_state(), the
+ * derived buffers are rebuilt by init() and update(). Hence a run continues
+ * with
+ * \code
+ * g.init();
+ * restore(g, data, params);
+ * g.update();
+ * \endcode
+ * if the checkpoint was taken between advance() and update(). The parameter
+ * map is stored as well and needs to agree when restoring. The format is the
+ * native one of util::write(), see serialize.hpp.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_CHECKPOINT_HPP_GUARD
+#define SIQUAN_CHECKPOINT_HPP_GUARD
+
+#include "tools/serialize.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace siquan {  // documented in base.hpp
+namespace detail {
+    /// \brief first entry of every checkpoint, changes with the format
+    inline std::string checkpoint_magic() { return "siquan checkpoint 1"; }
+}  // end namespace detail
+
+/// \brief returns the checkpoint of the grid \p g and its parameters \p m
+/// \tparam M \p std::map<std::string, std::string> like type, usually filled
+/// by \p param::to_map
+template <typename G, typename M>
+std::string checkpoint(G const &g, M const &m) {
+    std::ostringstream os;
+    util::write(os, detail::checkpoint_magic());
+    util::write(os, std::map<std::string, std::string>(m.begin(), m.end()));
+    g.save_state(os);
+    return os.str();
+}
+
+/// \brief restores the grid \p g from the checkpoint \p data
+/// \pre g.init() was called
+/// \throws std::runtime_error if \p data is no checkpoint, was written with
+/// other parameters than \p m or does not match the modules of \p g
+template <typename G, typename M>
+void restore(G &g, std::string const &data, M const &m) {
+    std::istringstream is(data);
+    std::string magic;
+    std::map<std::string, std::string> params;
+    util::read(is, magic);
+    if(magic != detail::checkpoint_magic())
+        throw std::runtime_error("restore: no checkpoint");
+    util::read(is, params);
+    if(params != std::map<std::string, std::string>(m.begin(), m.end()))
+        throw std::runtime_error("restore: checkpoint of other parameters");
+    g.load_state(is);
+    if(is.peek() != std::char_traits<char>::eof())
+        throw std::runtime_error("restore: checkpoint of other modules");
+}
+
+/// \brief reads the whole file \p file into \p data
+/// \return false if the file cannot be opened
+inline bool read_file(std::string const &file, std::string &data) {
+    std::ifstream ifs(file, std::ios::binary);
+    if(not ifs) return false;
+    data.assign(std::istreambuf_iterator<char>(ifs),
+                std::istreambuf_iterator<char>());
+    return true;
+}
+
+/// \brief writes checkpoints to a file in the background
+/// \details The simulation only stalls for checkpoint() (a copy of the state
+/// in memory), the file is written by an own thread. It goes to
+/// <tt>file + ".tmp"</tt> first and is renamed afterwards, s.t. \p file always
+/// holds a complete checkpoint, even if the process is killed while writing.
+class checkpoint_writer {
+public:
+    /// \brief Constructor
+    /// \param file the checkpoints are written to
+    explicit checkpoint_writer(std::string file) : file_(std::move(file)) {}
+    checkpoint_writer(checkpoint_writer const &) = delete;
+    checkpoint_writer &operator=(checkpoint_writer const &) = delete;
+    /// \brief waits for the last write, errors are dropped
+    ~checkpoint_writer() {
+        if(thread_.joinable()) thread_.join();
+    }
+
+    /// \brief starts writing \p data, after the previous write finished
+    /// \throws std::runtime_error if the previous write failed
+    void write(std::string data) {
+        wait();
+        thread_ = std::thread(
+            [this](std::string const &d) {
+                std::string const tmp = file_ + ".tmp";
+                {
+                    std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+                    ofs.write(d.data(), d.size());
+                    if(not ofs.flush()) {
+                        error_ = "checkpoint_writer: cannot write " + tmp;
+                        return;
+                    }
+                }
+                if(std::rename(tmp.c_str(), file_.c_str()) != 0)
+                    error_ = "checkpoint_writer: cannot rename " + tmp;
+            },
+            std::move(data));
+    }
+    /// \brief waits until the last write is on disk
+    /// \throws std::runtime_error if it failed
+    void wait() {
+        if(thread_.joinable()) thread_.join();
+        if(not error_.empty()) {
+            std::string const e = std::move(error_);
+            error_.clear();
+            throw std::runtime_error(e);
+        }
+    }
+    /// \brief returns the file the checkpoints are written to
+    std::string const &file() const { return file_; }
+
+private:
+    std::string file_;
+    std::string error_;  // of the last write, set by thread_
+    std::thread thread_;
+};
+}  // end namespace siquan
+
+#endif  // SIQUAN_CHECKPOINT_HPP_GUARD
@@ -57,6 +57,7 @@ namespace siquan
 #include "readPythonStructure.hpp"
 #include "remap.hpp"
 #include "schedule.hpp"
+#include "shared.hpp"
 #include "unmap.hpp"
 
 #endif // SIQUAN_CONNECT_CONNECT_HPP_GUARD
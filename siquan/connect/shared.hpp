@@ -0,0 +1,132 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief provides preprocessed connections that are shared read-only between
+ * many grids
+ * \details A problem is read and preprocessed once by the usual connect
+ * modules (e.g. read_in_txt, remap, merge_equal). shared::extract() copies
+ * the result into a problem_type, that any amount of grids built on
+ * connect::shared use without copying it again, e.g. one grid per seed and
+ * thread. Since the connections are const, connect::shared replaces
+ * connect::basic and no module that modifies the connections can be mixed in
+ * after it (normalize_weight works on its own copy).
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_CONNECT_SHARED_HPP_GUARD
+#define SIQUAN_CONNECT_SHARED_HPP_GUARD
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+namespace siquan {   // documented in base.hpp
+namespace connect {  // documented in connect.hpp
+
+    /// \brief provides the same connections, number of variables &
+    /// connections and mapping as connect::basic, but from a preprocessed
+    /// problem that is shared with other grids
+    /// \tparam super is the parent module which needs to provide the types
+    /// \p connect_vec_type, \p size_type, \p vert_type and \p user_type
+    template <typename super>
+    class shared : public super {
+        using s_param = typename super::param;
+
+    public:
+        /*==using declarations===*/
+        using typename super::connect_vec_type;
+        using typename super::size_type;
+        using typename super::vert_type;
+        using typename super::user_type;
+        using itou_type = std::map<vert_type, user_type>;
+        ///< the mapping type from internal labels to user labels
+
+        /// \brief the preprocessed problem, never modified after extract()
+        struct problem_type {
+            size_type n_vert;
+            size_type n_edge;
+            connect_vec_type connect;
+            itou_type itou;
+        };
+        using problem_ptr = std::shared_ptr<problem_type const>;
+
+        /// \brief param stage for this module
+        struct param : public s_param {
+            problem_ptr problem;
+            ///< the shared problem, set by the caller (not part of the map)
+
+            /// \brief passes through to the super
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void to_map(M &m) const {
+                s_param::to_map(m);
+            }
+            /// \brief passes through to the super
+            /// \param m \p std::map<std::string, std::string> like instance.
+            template <typename M>
+            void from_map(M const &m) {
+                s_param::from_map(m);
+            }
+        };
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param p constructor argument for super and holds the problem
+        shared(param const &p) : super(p), problem_(p.problem) {
+            if(not problem_)
+                throw std::runtime_error("shared: no problem was set");
+        }
+        /// \brief copies the preprocessed connections of the initialized
+        /// grid \p g
+        /// \tparam G grid type with a connect::basic module
+        template <typename G>
+        static problem_ptr extract(G const &g) {
+            return std::make_shared<problem_type const>(problem_type{
+                g.n_vert(), g.n_edge(), g.get_connect(), g.get_itou()});
+        }
+        /*==== const methods ====*/
+
+        /// \brief returns the connections
+        connect_vec_type const &get_connect() const {
+            return problem_->connect;
+        }
+        /// \brief returns the (i)nternal (to) (u)ser mapping
+        itou_type const &get_itou() const { return problem_->itou; }
+        /// \brief returns the amount of vertices/spins
+        size_type const &n_vert() const { return problem_->n_vert; }
+        /// \brief returns the amount of connections/interactions/edges
+        size_type const &n_edge() const { return problem_->n_edge; }
+
+        /// \brief print a short help of the super and then itself
+        void help() const {
+            super::help();
+            std::cout << "connect::shared:\n\
+    Holds the connections/interactions/edges of a problem that was read and \n\
+    preprocessed by another grid. The connections can't be modified."
+                      << std::endl;
+        }
+
+    private:
+        problem_ptr problem_;
+    };
+}  // end namespace connect
+}  // end namespace siquan
+#endif  // SIQUAN_CONNECT_SHARED_HPP_GUARD
@@ -25,6 +25,8 @@
 #ifndef SIQUAN_OBSERVER_ENERGY_HPP_GUARD
 #define SIQUAN_OBSERVER_ENERGY_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 namespace siquan {    // documented in base.hpp
 namespace observer {  // documented in observer.hpp
     /// \brief tracks the energy of the super module (can be a decoded trotter
@@ -47,6 +49,18 @@ namespace observer {  // documented in observer.hpp
             super::calc();
             energy_.push_back(super::energy());
         }
+        /// \brief writes the super and then the measured energies to \p s
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, energy_);
+        }
+        /// \brief reads the super and then the measured energies from \p s
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            util::read(s, energy_);
+        }
         /// \brief returns a vector of energies
         std::vector<weight_type> const &get_energy_evolution() const {
             return energy_;
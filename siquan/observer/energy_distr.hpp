@@ -26,6 +26,8 @@
 #ifndef SIQUAN_OBSERVER_ENERGY_DISTR_HPP_GUARD
 #define SIQUAN_OBSERVER_ENERGY_DISTR_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 namespace siquan {    // documented in base.hpp
 namespace observer {  // documented in observer.hpp
     /// \brief tracks the energy distribution of the super module
@@ -50,6 +52,18 @@ namespace observer {  // documented in observer.hpp
             super::calc();
             energy_.push_back(super::get_energy_distr());
         }
+        /// \brief writes the super and then the measured distributions to \p s
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, energy_);
+        }
+        /// \brief reads the super and then the measured distributions from \p s
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            util::read(s, energy_);
+        }
         /// \brief returns a vector of energy distributions
         /// \details a single distribution has the number of bodies as key,
         /// i.e. for the energy of all 2-body terms,
@@ -25,6 +25,8 @@
 #ifndef SIQUAN_OBSERVER_SCHEDULER_HPP_GUARD
 #define SIQUAN_OBSERVER_SCHEDULER_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 /// \brief Observes a scheduler
 /// \details Since the \ref scheduler.hpp are instanciated with macros, another
 /// macro for observing them is necessary. The access function is
@@ -41,6 +43,16 @@
             super::update();                                        \
             sched_.push_back(super::temperature());                 \
         }                                                           \
+        template <typename S>                                       \
+        void save_state(S &s) const {                               \
+            super::save_state(s);                                   \
+            util::write(s, sched_);                                 \
+        }                                                           \
+        template <typename S>                                       \
+        void load_state(S &s) {                                     \
+            super::load_state(s);                                   \
+            util::read(s, sched_);                                  \
+        }                                                           \
         std::vector<temp_type> const &get_##T##_evolution() const { \
             return sched_;                                          \
         }                                                           \
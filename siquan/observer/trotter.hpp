@@ -25,6 +25,8 @@
 #ifndef SIQUAN_OBSERVER_TROTTER_HPP_GUARD
 #define SIQUAN_OBSERVER_TROTTER_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 namespace siquan {    // documented in base.hpp
 namespace observer {  // documented in observer.hpp
     /// \brief tracks the trotter state and energies over the simulation
@@ -47,12 +49,12 @@ namespace observer {  // documented in observer.hpp
             super::update();
             super::calc();
             auto const &lat = super::get_state();
-            auto const &ener = super::get_energy_distr();
+            auto const &ener = super::get_energy();
 
             ts_states_.push_back(std::vector<std::vector<bool>>());
             ts_ener_.push_back(std::vector<weight_type>());
             for(uint32_t j = 0; j < lat[0].size(); ++j)
-                ts_ener_.back().push_back(ener[j].at(0));
+                ts_ener_.back().push_back(ener[j]);
 
             for(uint32_t i = 0; i < lat.size(); ++i) {
                 ts_states_.back().push_back(std::vector<bool>());
@@ -61,6 +63,22 @@ namespace observer {  // documented in observer.hpp
                 }
             }
         }
+        /// \brief writes the super and then the measured states and energies
+        /// to \p s
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, ts_states_);
+            util::write(s, ts_ener_);
+        }
+        /// \brief reads the super and then the measured states and energies
+        /// from \p s
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            util::read(s, ts_states_);
+            util::read(s, ts_ener_);
+        }
         /// \brief returns a vector of trotter states
         std::vector<std::vector<std::vector<bool>>> const &
         get_trotter_state_evolution() const {
@@ -47,6 +47,16 @@
             super::advance(o);                                                 \
             T##_ += T##_incr_;                                                 \
         }                                                                      \
+        template <typename S>                                                  \
+        void save_state(S &s) const {                                          \
+            super::save_state(s);                                              \
+            util::write(s, T##_);                                              \
+        }                                                                      \
+        template <typename S>                                                  \
+        void load_state(S &s) {                                                \
+            super::load_state(s);                                              \
+            util::read(s, T##_);                                               \
+        }                                                                      \
         /*==== const methods ====*/                                            \
         temp_type temperature() const noexcept { return 1. / T##_; }           \
                                                                                \
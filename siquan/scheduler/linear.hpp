@@ -25,6 +25,8 @@
 #ifndef SIQUAN_SCHEDULER_LINEAR_HPP_GUARD
 #define SIQUAN_SCHEDULER_LINEAR_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 #include <fsc/stdSupport.hpp>
 
 #include <assert.h>
@@ -70,6 +72,16 @@
             super::advance(o);                                                 \
             T##_ += T##_incr_;                                                 \
         }                                                                      \
+        template <typename S>                                                  \
+        void save_state(S &s) const {                                          \
+            super::save_state(s);                                              \
+            util::write(s, T##_);                                              \
+        }                                                                      \
+        template <typename S>                                                  \
+        void load_state(S &s) {                                                \
+            super::load_state(s);                                              \
+            util::read(s, T##_);                                               \
+        }                                                                      \
         /*==== const methods ====*/                                            \
         temp_type const &temperature() const noexcept { return T##_; }         \
                                                                                \
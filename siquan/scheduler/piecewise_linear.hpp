@@ -25,6 +25,8 @@
 #ifndef SIQUAN_SCHEDULER_PIECEWISE_LINEAR_HPP_GUARD
 #define SIQUAN_SCHEDULER_PIECEWISE_LINEAR_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 #include <fsc/stdSupport.hpp>
 
 #include <cmath>
@@ -137,6 +139,16 @@ namespace scheduler {  // documented in scheduler.hpp
             super::advance(o);                                                 \
             T##_ = T##_pl_(super::counter());                                  \
         }                                                                      \
+        template <typename S>                                                  \
+        void save_state(S &s) const {                                          \
+            super::save_state(s);                                              \
+            util::write(s, T##_);                                              \
+        }                                                                      \
+        template <typename S>                                                  \
+        void load_state(S &s) {                                                \
+            super::load_state(s);                                              \
+            util::read(s, T##_);                                               \
+        }                                                                      \
         /*==== const methods ====*/                                            \
         double const &temperature() const noexcept { return T##_; }            \
                                                                                \
@@ -25,6 +25,8 @@
 #ifndef SIQUAN_SCHEDULER_STEP_HPP_GUARD
 #define SIQUAN_SCHEDULER_STEP_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 #include <fsc/stdSupport.hpp>
 
 namespace siquan {     // documented in base.hpp
@@ -75,6 +77,18 @@ namespace scheduler {  // documented in scheduler.hpp
             super::advance(o);
             ++counter_;
         }
+        /// \brief writes the super and then the step count to \p s
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, counter_);
+        }
+        /// \brief reads the super and then the step count from \p s
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            util::read(s, counter_);
+        }
         //==== const methods ====//
         /// \brief stops the simulations after \p steps steps
         bool stop() const { return super::stop() or counter_ >= steps_; }
@@ -25,7 +25,11 @@
 #ifndef SIQUAN_STATE_SIMPLE_HPP_GUARD
 #define SIQUAN_STATE_SIMPLE_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 #include <fsc/stdSupport.hpp>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace siquan {  // documented in base.hpp
@@ -65,6 +69,36 @@ namespace state {
                 }
             }
         }
+        /// \brief swaps the configuration with the grid \p g of the same type
+        /// \details only the buffers are exchanged, the connections stay
+        template <typename G>
+        void swap_state(G &g) {
+            super::swap_state(g);
+            std::swap(state_, static_cast<simple &>(g).state_);
+        }
+        /// \brief copies the configuration of the grid \p g of the same type
+        /// into the own buffers
+        template <typename G>
+        void copy_state(G const &g) {
+            super::copy_state(g);
+            state_ = static_cast<simple const &>(g).state_;
+        }
+        /// \brief writes the super and then the configuration to \p s
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, state_);
+        }
+        /// \brief reads the super and then the configuration from \p s
+        /// \throws std::runtime_error if \p s holds another amount of spins
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            auto const n = state_.size();
+            util::read(s, state_);
+            if(state_.size() != n)
+                throw std::runtime_error("simple: checkpoint of another size");
+        }
         /*==== const methods ====*/
         /// \brief get the current configuration state
         state_type const &get_state() const { return state_; }
@@ -25,7 +25,11 @@
 #ifndef SIQUAN_STATE_TROTTER_HPP_GUARD
 #define SIQUAN_STATE_TROTTER_HPP_GUARD
 
+#include "../tools/serialize.hpp"
+
 #include <fsc/stdSupport.hpp>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace siquan {  // documented in base.hpp
@@ -93,6 +97,41 @@ namespace state {   // documented in simple.hpp
                 }
             }
         }
+        /// \brief swaps the configuration with the grid \p g of the same type
+        /// \details only the buffers are exchanged, the connections stay
+        template <typename G>
+        void swap_state(G &g) {
+            super::swap_state(g);
+            std::swap(state_, static_cast<trotter &>(g).state_);
+        }
+        /// \brief copies the configuration of the grid \p g of the same type
+        /// into the own buffers
+        template <typename G>
+        void copy_state(G const &g) {
+            super::copy_state(g);
+            state_ = static_cast<trotter const &>(g).state_;
+        }
+        /// \brief writes the super and then the configuration to \p s
+        template <typename S>
+        void save_state(S &s) const {
+            super::save_state(s);
+            util::write(s, uint64_t(state_.size()));
+            util::write(s, uint64_t(nt_));
+            for(auto const &line : state_) util::write_words(s, line);
+        }
+        /// \brief reads the super and then the configuration from \p s
+        /// \throws std::runtime_error if \p s holds another amount of spins
+        /// or slices
+        template <typename S>
+        void load_state(S &s) {
+            super::load_state(s);
+            uint64_t n, nt;
+            util::read(s, n);
+            util::read(s, nt);
+            if(n != state_.size() or nt != nt_)
+                throw std::runtime_error("trotter: checkpoint of another size");
+            for(auto &line : state_) util::read_words(s, line);
+        }
         /*==== const methods ====*/
         /// \brief get the current configuration state
         state_type const &get_state() const { return state_; }
@@ -0,0 +1,134 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2014, ETH Zurich, ITP, Bettina Heim                               *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief generates words of independent bits that are set with a given
+ * probability
+ * \details Based on L. Pierre, T. Giamarchi, H.J. Schulz (1987), Journal of
+ * Statistical Physics, vol. 48, no. 1, pages 135-149: the probability is
+ * written with \p Precision bits and every uniform random word resolves one
+ * binary digit for all 64 bits at once. A bit is final as soon as its random
+ * digits differ from the ones of the probability, hence the tree stops after
+ * about log2(64) + 2 words instead of \p Precision.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2014      | ETH Zurich, D-PHYS, Bettina Heim
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TOOLS_BERNOULLI_BITS_HPP_GUARD
+#define SIQUAN_TOOLS_BERNOULLI_BITS_HPP_GUARD
+
+#include "engines.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace util {  // documented in random.hpp
+
+/// \brief Bernoulli distribution for whole 64 bit words with an own engine
+/// \details The words are produced \p N at a time by xoshiro256ss_lanes, all
+/// lanes walk the precision tree together and stop as soon as every lane is
+/// resolved. The table of the probability is only rebuilt if param() gets a
+/// new value.
+/// \tparam N amount of words produced at once
+/// \tparam Precision bits of the probability, (0, 64)
+template <std::size_t N = 4, int Precision = 32>
+class bernoulli_bits {
+    static_assert(Precision > 0 && Precision < 64, "invalid precision");
+    using engine_type = xoshiro256ss_lanes<N>;
+    using block_type = typename engine_type::block_type;
+
+public:
+    using result_type = uint64_t;  ///< one word of bits
+
+    /// \brief Constructor
+    /// \param seed seeds the own engine
+    /// \param p probability of a bit to be set
+    explicit bernoulli_bits(uint64_t const &seed = 0, double const &p = 0.5)
+        : engine_(seed), prob_(-1), lowest_(Precision - 1), pos_(N) {
+        param(p);
+    }
+    /// \brief seeds the own engine and drops buffered words
+    void seed(uint64_t const &seed) {
+        engine_.seed(seed);
+        pos_ = N;
+    }
+    /// \brief sets the probability of a bit to be set
+    void param(double const &p) {
+        assert(p >= 0. && p <= 1.);
+        if(p == prob_) return;
+        prob_ = p;
+        uint64_t probbits = p * (1ull << Precision);
+        probbits ^= (probbits >> 1);
+        lowest_ = Precision - 1;
+        for(int i = 0; i < Precision; ++i) {
+            table_[i] = probbits & (1ull << i) ? ~result_type(0) : 0;
+            if(table_[i] && i < lowest_) lowest_ = i;
+        }
+        pos_ = N;  // buffered words have the old probability
+    }
+    /// \brief the probability of a bit to be set
+    double const &param() const { return prob_; }
+
+    /// \brief returns the next word
+    result_type operator()() {
+        if(pos_ == N) {
+            refill_();
+            pos_ = 0;
+        }
+        return block_[pos_++];
+    }
+    /// \brief overwrites all slices of \p line, which needs to provide
+    /// \p generate(gen) with one word per call of \p gen
+    template <typename line_type>
+    void operator()(line_type &line) {
+        line.generate([this]() { return (*this)(); });
+    }
+
+private:
+    void refill_() {
+        block_type a, r;
+        a.fill(~result_type(0));
+        block_.fill(table_[Precision - 1]);
+        // digits below lowest_ are zero and do not change any bit
+        for(int i = Precision - 2; i >= lowest_; --i) {
+            engine_(r);
+            result_type any = 0;
+            for(std::size_t l = 0; l < N; ++l) {
+                a[l] &= r[l];
+                block_[l] ^= a[l] & table_[i];
+                any |= a[l];
+            }
+            if(!any) break;
+        }
+    }
+
+private:
+    engine_type engine_;
+    double prob_;
+    std::array<result_type, Precision> table_;
+    int lowest_;  // lowest nonzero entry of table_
+    block_type block_;
+    std::size_t pos_;  // next unused word in block_
+};
+}  // end namespace util
+
+#endif  // SIQUAN_TOOLS_BERNOULLI_BITS_HPP_GUARD
@@ -0,0 +1,284 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief fast 64 bit random engines, usable like the std engines
+ * \details Both engines fulfill the UniformRandomBitGenerator requirements
+ * and can be seeded with a single integer (e.g. from seed_param::seed_rng()),
+ * which is expanded with splitmix64. A module selects the engine with the
+ * \p rng_type of the type_carrier:
+ * engine          | state    | reference
+ * ----            | -----    | -------------
+ * \p xoshiro256ss | 256 bit  | D. Blackman, S. Vigna, xoshiro256**
+ * \p pcg64        | 128 bit  | M. E. O'Neill, PCG XSL-RR 128/64
+ *
+ * xoshiro256ss_lanes runs several jumped xoshiro256** streams side by side for
+ * vectorized consumers like bernoulli_bits.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TOOLS_ENGINES_HPP_GUARD
+#define SIQUAN_TOOLS_ENGINES_HPP_GUARD
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace util {  // documented in random.hpp
+/// \cond IMPLEMENTATION_DETAIL_DOC
+namespace detail {
+    // used to expand one seed into the engine state
+    inline uint64_t splitmix64(uint64_t &x) noexcept {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+    inline uint64_t rotl(uint64_t const x, int const k) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+}  // end namespace detail
+/// \endcond
+
+/// \brief the xoshiro256** engine, fast all purpose 64 bit engine
+class xoshiro256ss {
+public:
+    using result_type = uint64_t;  ///< std engine interface
+    using state_type = std::array<result_type, 4>;  ///< the engine state
+
+    /// \brief Constructor
+    /// \param seed gets expanded into the 256 bit state
+    explicit xoshiro256ss(result_type const &seed = 0) { this->seed(seed); }
+    /// \brief std engine interface
+    /// \param seed gets expanded into the 256 bit state
+    void seed(result_type seed) noexcept {
+        for(auto &s : s_) s = detail::splitmix64(seed);
+    }
+    /// \brief std engine interface, returns the next random number
+    result_type operator()() noexcept {
+        result_type const res = detail::rotl(s_[1] * 5, 7) * 9;
+        result_type const t = s_[1] << 17;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3] = detail::rotl(s_[3], 45);
+        return res;
+    }
+    /// \brief std engine interface
+    void discard(unsigned long long n) noexcept {
+        for(; n; --n) (*this)();
+    }
+    /// \brief advances the engine by 2^128 calls, used to generate
+    /// non-overlapping streams
+    void jump() noexcept {
+        static constexpr result_type j[] = {
+            0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+            0xa9582618e03fc9aaull, 0x39abdc4529b1661cull};
+        state_type s = {0, 0, 0, 0};
+        for(auto const &w : j) {
+            for(int b = 0; b < 64; ++b) {
+                if(w & (result_type(1) << b))
+                    for(int k = 0; k < 4; ++k) s[k] ^= s_[k];
+                (*this)();
+            }
+        }
+        s_ = s;
+    }
+    /// \brief std engine interface
+    static constexpr result_type min() noexcept { return 0; }
+    /// \brief std engine interface
+    static constexpr result_type max() noexcept {
+        return std::numeric_limits<result_type>::max();
+    }
+    /// \brief engines with identical state produce identical numbers
+    bool operator==(xoshiro256ss const &rhs) const noexcept {
+        return s_ == rhs.s_;
+    }
+    /// \brief the 256 bit state
+    state_type const &state() const noexcept { return s_; }
+
+private:
+    state_type s_;
+};
+
+/// \brief \p N interleaved xoshiro256** streams that produce \p N numbers
+/// per call
+/// \details The state is stored lane by lane (structure of arrays), s.t. the
+/// steps of four lanes map onto one AVX2 register if the compiler targets
+/// it. Lane \p l is the scalar engine jumped \p l times, so the
+/// streams do not overlap.
+/// \tparam N amount of lanes
+template <std::size_t N>
+class xoshiro256ss_lanes {
+public:
+    using result_type = uint64_t;  ///< type of one lane
+    using block_type = std::array<result_type, N>;  ///< one number per lane
+
+    /// \brief Constructor
+    /// \param seed seeds the first lane, see seed()
+    explicit xoshiro256ss_lanes(result_type const &seed = 0) {
+        this->seed(seed);
+    }
+    /// \brief seeds lane 0 like xoshiro256ss and every further lane with
+    /// the state of the previous one after a jump()
+    void seed(result_type const &seed) noexcept {
+        xoshiro256ss lane(seed);
+        for(std::size_t l = 0; l < N; ++l) {
+            for(std::size_t k = 0; k < 4; ++k) s_[k][l] = lane.state()[k];
+            lane.jump();
+        }
+    }
+    /// \brief writes the next random number of every lane into \p res
+    void operator()(block_type &res) noexcept {
+#if defined(__AVX2__)
+        if(N % 4 == 0) {
+            for(std::size_t l = 0; l < N; l += 4) step4_(res.data() + l, l);
+            return;
+        }
+#endif
+        for(std::size_t l = 0; l < N; ++l) {
+            result_type const x = s_[1][l] * 5;
+            res[l] = ((x << 7) | (x >> 57)) * 9;
+        }
+        for(std::size_t l = 0; l < N; ++l) {
+            result_type const t = s_[1][l] << 17;
+            s_[2][l] ^= s_[0][l];
+            s_[3][l] ^= s_[1][l];
+            s_[1][l] ^= s_[2][l];
+            s_[0][l] ^= s_[3][l];
+            s_[2][l] ^= t;
+            s_[3][l] = (s_[3][l] << 45) | (s_[3][l] >> 19);
+        }
+    }
+
+private:
+#if defined(__AVX2__)
+    // the same step for the lanes l to l + 3 with AVX2 registers
+    void step4_(result_type *res, std::size_t const &l) noexcept {
+        auto const load = [&](std::size_t k) {
+            return _mm256_loadu_si256(
+                reinterpret_cast<__m256i const *>(s_[k].data() + l));
+        };
+        auto const shl = [](__m256i x, int k) {
+            return _mm256_slli_epi64(x, k);
+        };
+        auto const rotl = [](__m256i x, int k) {
+            return _mm256_or_si256(_mm256_slli_epi64(x, k),
+                                   _mm256_srli_epi64(x, 64 - k));
+        };
+        __m256i s0 = load(0), s1 = load(1), s2 = load(2), s3 = load(3);
+
+        __m256i x = _mm256_add_epi64(s1, shl(s1, 2));  // s1 * 5
+        x = rotl(x, 7);
+        x = _mm256_add_epi64(x, shl(x, 3));  // * 9
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(res), x);
+
+        __m256i const t = shl(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = rotl(s3, 45);
+
+        __m256i *const out[] = {
+            reinterpret_cast<__m256i *>(s_[0].data() + l),
+            reinterpret_cast<__m256i *>(s_[1].data() + l),
+            reinterpret_cast<__m256i *>(s_[2].data() + l),
+            reinterpret_cast<__m256i *>(s_[3].data() + l)};
+        _mm256_storeu_si256(out[0], s0);
+        _mm256_storeu_si256(out[1], s1);
+        _mm256_storeu_si256(out[2], s2);
+        _mm256_storeu_si256(out[3], s3);
+    }
+#endif
+
+private:
+    std::array<block_type, 4> s_;
+};
+
+/// \brief the pcg64 (XSL-RR 128/64) engine, a 128 bit LCG with a permuted
+/// output
+class pcg64 {
+    __extension__ typedef unsigned __int128 state_type;
+
+public:
+    using result_type = uint64_t;  ///< std engine interface
+
+    /// \brief Constructor
+    /// \param seed gets expanded into the 128 bit state and stream
+    explicit pcg64(result_type const &seed = 0) { this->seed(seed); }
+    /// \brief std engine interface
+    /// \param seed gets expanded into the 128 bit state and stream
+    void seed(result_type seed) noexcept {
+        state_type const init = make_(seed);
+        inc_ = (make_(seed) << 1) | 1;  // the stream needs to be odd
+        state_ = 0;
+        (*this)();
+        state_ += init;
+        (*this)();
+    }
+    /// \brief std engine interface, returns the next random number
+    result_type operator()() noexcept {
+        state_ = state_ * mult_() + inc_;
+        auto const rot = static_cast<int>(state_ >> 122);
+        auto const xsl = static_cast<result_type>(state_ >> 64) ^
+                         static_cast<result_type>(state_);
+        return (xsl >> rot) | (xsl << ((-rot) & 63));
+    }
+    /// \brief std engine interface
+    void discard(unsigned long long n) noexcept {
+        for(; n; --n) (*this)();
+    }
+    /// \brief std engine interface
+    static constexpr result_type min() noexcept { return 0; }
+    /// \brief std engine interface
+    static constexpr result_type max() noexcept {
+        return std::numeric_limits<result_type>::max();
+    }
+    /// \brief engines with identical state produce identical numbers
+    bool operator==(pcg64 const &rhs) const noexcept {
+        return state_ == rhs.state_ and inc_ == rhs.inc_;
+    }
+
+private:
+    static state_type make_(result_type &seed) noexcept {
+        state_type const hi = detail::splitmix64(seed);
+        return (hi << 64) | detail::splitmix64(seed);
+    }
+    static state_type mult_() noexcept {
+        return (state_type(2549297995355413924ull) << 64) |
+               4865540595714422341ull;
+    }
+
+private:
+    state_type state_;
+    state_type inc_;
+};
+
+}  // end namespace util
+
+#endif  // SIQUAN_TOOLS_ENGINES_HPP_GUARD
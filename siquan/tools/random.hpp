@@ -15,7 +15,7 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
 
 /** \file
- * \brief uniform random generator with a local static engine
+ * \brief uniform random generator with an own engine per instance
  * \author
  * Year      |  Name
  * ----      | -----
@@ -29,18 +29,13 @@
 #include <random>
 #include <type_traits>
 
-/// \brief Holds local static seeds and engines, for consistent seeding across
+/// \brief Holds local static default seeds, for consistent seeding across
 /// compilation units.
 namespace util {
 /// \cond IMPLEMENTATION_DETAIL_DOC
 namespace detail {
     using seed_type = uint64_t;
 
-    template <typename ENGINE>
-    ENGINE& get_engine(seed_type const& seed) {
-        static ENGINE engine(seed);
-        return engine;
-    }
     template <typename ENGINE>
     seed_type& get_seed(seed_type const& init = 0) {
         static seed_type seed = init;
@@ -58,31 +53,31 @@ namespace detail {
 }  // end namespace detail
 /// \endcond
 
-/// \brief seeds a local static engine
+/// \brief sets the default seed of the rng_class instances with engine
+/// \p ENGINE that are constructed afterwards
 /// \tparam ENGINE is the type of the engine we want to seed
 /// \param seed
 template <typename ENGINE = std::mt19937>
 void seed(detail::seed_type const& seed) {
-    auto& seedref = detail::get_seed<ENGINE>();
-    auto& engineref = detail::get_engine<ENGINE>(seed);
-    seedref = seed;
-    engineref.seed(seedref);
+    detail::get_seed<ENGINE>(seed) = seed;
 }
 
-/// \brief get the seed of a local static engine
+/// \brief get the default seed of engine type \p ENGINE
 /// \tparam ENGINE is the type of the engine we want to get the seed from
 template <typename ENGINE = std::mt19937>
 detail::seed_type seed() {
-    return detail::get_seed<ENGINE>();
+    return detail::get_seed<ENGINE>(uint64_t(time(NULL)));
 }
 
-/// \brief a simple fast uniform random number generator using a local static
-/// engine
+/// \brief a simple fast uniform random number generator with an own engine
 /// \tparam T type of the random number generator \tparam ENGINE type of
 /// the engine to use
-/// \details Be aware that there is only ever one engine of
-/// one type, i.e. it you create two identical rng_class instances, they will
-/// use the same engine and even if seeded the same not return the same values.
+/// \details Every instance owns its engine, i.e. instances can be used from
+/// different threads and seeding one does not affect the others. Unseeded
+/// instances start from the default seed (see util::seed), two of them hence
+/// return the same values. Streams for many threads can be derived from one
+/// root engine by jump-ahead, e.g. util::xoshiro256ss::jump(), and passed to
+/// the constructor.
 template <typename T, typename ENGINE = std::mt19937>
 class rng_class {
     using seed_type = detail::seed_type;
@@ -95,29 +90,35 @@ public:
     /// \details For integral types \p T, the upper bound is included, as for
     /// floating point types it is not.
     rng_class(T const& lower, T const& upper)
-        : seedref_(detail::get_seed<ENGINE>(uint64_t(time(NULL)))),
-          engineref_(detail::get_engine<ENGINE>(seedref_)),
-          distr_(lower, upper) {}
+        : seed_(util::seed<ENGINE>()), engine_(seed_), distr_(lower, upper) {}
+    /// \brief
+    /// \param lower,upper the bounds of the random intervall
+    /// \param engine the engine to draw from, e.g. a jumped stream
+    rng_class(T const& lower, T const& upper, ENGINE const& engine)
+        : seed_(0), engine_(engine), distr_(lower, upper) {}
 
     /// \brief Get a random number
-    T operator()() { return distr_(engineref_); }
+    T operator()() { return distr_(engine_); }
     /// \brief get the seed
-    seed_type const& seed() noexcept { return seedref_; }
+    seed_type const& seed() noexcept { return seed_; }
     /// \brief set the seed
     /// \param seed the desired value
     void seed(seed_type const& seed) noexcept {
-        seedref_ = seed;
-        engineref_.seed(seedref_);
+        seed_ = seed;
+        engine_.seed(seed_);
+        distr_.reset();
     }
     /// \brief change the range of the uniform distribution
     /// \param lower,upper the new range
     void set_range(T const& lower, T const& upper) {
         distr_ = distr_type(lower, upper);
     }
+    /// \brief access to the own engine
+    ENGINE& engine() noexcept { return engine_; }
 
 private:
-    seed_type& seedref_;
-    ENGINE& engineref_;
+    seed_type seed_;
+    ENGINE engine_;
     distr_type distr_;
 };
 }  // end namespace util
@@ -0,0 +1,177 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief binary serialization of values, vectors and maps for checkpoints
+ * \details Trivially copyable values (numbers, engines, distributions without
+ * a cache) are written as their bytes, containers as their size followed by
+ * the elements, \p std::vector<bool> packed to bytes. The format is native
+ * (endianness, sizes), i.e. a checkpoint is read on the machine type that
+ * wrote it.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TOOLS_SERIALIZE_HPP_GUARD
+#define SIQUAN_TOOLS_SERIALIZE_HPP_GUARD
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace util {  // documented in random.hpp
+
+// the containers call each other for their elements
+template <typename T, typename A>
+void write(std::ostream &os, std::vector<T, A> const &v);
+template <typename T, typename A>
+void read(std::istream &is, std::vector<T, A> &v);
+template <typename K, typename V, typename C, typename A>
+void write(std::ostream &os, std::map<K, V, C, A> const &m);
+template <typename K, typename V, typename C, typename A>
+void read(std::istream &is, std::map<K, V, C, A> &m);
+
+/// \brief writes the bytes of the trivially copyable \p x to \p os
+template <typename T>
+typename std::enable_if<std::is_trivially_copyable<T>::value>::type write(
+    std::ostream &os, T const &x) {
+    os.write(reinterpret_cast<char const *>(&x), sizeof(T));
+}
+/// \brief reads the bytes of the trivially copyable \p x from \p is
+/// \throws std::runtime_error if \p is ends before
+template <typename T>
+typename std::enable_if<std::is_trivially_copyable<T>::value>::type read(
+    std::istream &is, T &x) {
+    if(not is.read(reinterpret_cast<char *>(&x), sizeof(T)))
+        throw std::runtime_error("util::read: unexpected end of data");
+}
+
+/// \brief writes the size of \p s and its characters
+inline void write(std::ostream &os, std::string const &s) {
+    write(os, uint64_t(s.size()));
+    os.write(s.data(), s.size());
+}
+/// \brief reads a string written by write()
+inline void read(std::istream &is, std::string &s) {
+    uint64_t n;
+    read(is, n);
+    s.resize(n);
+    if(n > 0 and not is.read(&s[0], n))
+        throw std::runtime_error("util::read: unexpected end of data");
+}
+
+/// \brief writes the size of \p v and its bits packed to bytes
+template <typename A>
+void write(std::ostream &os, std::vector<bool, A> const &v) {
+    write(os, uint64_t(v.size()));
+    for(std::size_t i = 0; i < v.size(); i += 8) {
+        uint8_t byte = 0;
+        for(std::size_t b = 0; b < 8 and i + b < v.size(); ++b)
+            byte |= uint8_t(v[i + b]) << b;
+        write(os, byte);
+    }
+}
+/// \brief reads a \p std::vector<bool> written by write()
+template <typename A>
+void read(std::istream &is, std::vector<bool, A> &v) {
+    uint64_t n;
+    read(is, n);
+    v.assign(n, false);
+    for(std::size_t i = 0; i < n; i += 8) {
+        uint8_t byte;
+        read(is, byte);
+        for(std::size_t b = 0; b < 8 and i + b < n; ++b)
+            v[i + b] = (byte >> b) & 1;
+    }
+}
+
+/// \brief writes the size of \p v and its elements
+template <typename T, typename A>
+void write(std::ostream &os, std::vector<T, A> const &v) {
+    write(os, uint64_t(v.size()));
+    if(std::is_trivially_copyable<T>::value)
+        os.write(reinterpret_cast<char const *>(v.data()),
+                 v.size() * sizeof(T));
+    else
+        for(auto const &x : v) write(os, x);
+}
+/// \brief reads a vector written by write()
+template <typename T, typename A>
+void read(std::istream &is, std::vector<T, A> &v) {
+    uint64_t n;
+    read(is, n);
+    v.resize(n);
+    if(std::is_trivially_copyable<T>::value) {
+        if(n > 0 and not is.read(reinterpret_cast<char *>(v.data()),
+                                 n * sizeof(T)))
+            throw std::runtime_error("util::read: unexpected end of data");
+    } else
+        for(auto &x : v) read(is, x);
+}
+
+/// \brief writes the size of \p m and its pairs
+template <typename K, typename V, typename C, typename A>
+void write(std::ostream &os, std::map<K, V, C, A> const &m) {
+    write(os, uint64_t(m.size()));
+    for(auto const &a : m) {
+        write(os, a.first);
+        write(os, a.second);
+    }
+}
+/// \brief reads a map written by write()
+template <typename K, typename V, typename C, typename A>
+void read(std::istream &is, std::map<K, V, C, A> &m) {
+    uint64_t n;
+    read(is, n);
+    m.clear();
+    for(uint64_t i = 0; i < n; ++i) {
+        K k;
+        V x;
+        read(is, k);
+        read(is, x);
+        m.emplace(std::move(k), std::move(x));
+    }
+}
+
+/// \brief writes the words of a trotter line (see types::trotter_line.hpp),
+/// the line needs to provide \p n_words() and \p word(i)
+template <typename L>
+void write_words(std::ostream &os, L const &line) {
+    for(std::size_t k = 0; k < line.n_words(); ++k)
+        write(os, uint64_t(line.word(k)));
+}
+/// \brief reads the words of a trotter line of the same size, the line needs
+/// to provide \p generate(gen)
+template <typename L>
+void read_words(std::istream &is, L &line) {
+    line.generate([&is]() {
+        uint64_t w;
+        read(is, w);
+        return w;
+    });
+}
+
+}  // end namespace util
+
+#endif  // SIQUAN_TOOLS_SERIALIZE_HPP_GUARD
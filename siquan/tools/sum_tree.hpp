@@ -0,0 +1,102 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief a binary tree of partial sums to sample an index proportional to its
+ * weight
+ * \details Every inner node holds the sum of its two children, s.t. changing
+ * one weight and drawing an index both take O(log n). The sums are recomputed
+ * from the children instead of updated by differences, hence no rounding
+ * errors accumulate over many changes.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TOOLS_SUM_TREE_HPP_GUARD
+#define SIQUAN_TOOLS_SUM_TREE_HPP_GUARD
+
+#include <cstddef>
+#include <vector>
+
+namespace util {  // documented in random.hpp
+
+/// \brief weights with O(log n) updates and sampling
+/// \tparam T non-negative weight type
+template <typename T = double>
+class sum_tree {
+public:
+    /// \brief Constructor
+    /// \param n amount of weights, all start at zero
+    explicit sum_tree(std::size_t const &n = 0) { resize(n); }
+
+    /// \brief sets the amount of weights to \p n and all weights to zero
+    void resize(std::size_t const &n) {
+        n_ = n;
+        leaves_ = 1;
+        while(leaves_ < n_) leaves_ <<= 1;
+        tree_.assign(2 * leaves_, T(0));
+    }
+    /// \brief sets weight \p i to \p w
+    void set(std::size_t const &i, T const &w) {
+        std::size_t k = leaves_ + i;
+        tree_[k] = w;
+        for(k >>= 1; k > 0; k >>= 1) tree_[k] = tree_[2 * k] + tree_[2 * k + 1];
+    }
+    /// \brief sets weight \p i to <tt>f(i)</tt> for all \p i in O(n)
+    template <typename F>
+    void assign(F &&f) {
+        for(std::size_t i = 0; i < n_; ++i) tree_[leaves_ + i] = f(i);
+        for(std::size_t k = leaves_ - 1; k > 0; --k)
+            tree_[k] = tree_[2 * k] + tree_[2 * k + 1];
+    }
+
+    /// \brief returns weight \p i
+    T const &operator[](std::size_t const &i) const {
+        return tree_[leaves_ + i];
+    }
+    /// \brief returns the sum of all weights
+    T const &total() const { return tree_[1]; }
+    /// \brief returns the amount of weights
+    std::size_t const &size() const { return n_; }
+    /// \brief returns the index \p i with <tt>sum_{j < i} w_j <= x <
+    /// sum_{j <= i} w_j</tt>, i.e. an index proportional to its weight for a
+    /// uniform \p x in [0, total())
+    /// \details a rounded \p x never selects a zero weight
+    std::size_t find(T x) const {
+        std::size_t k = 1;
+        while(k < leaves_) {
+            std::size_t const l = 2 * k;
+            if(x < tree_[l] or tree_[l + 1] == T(0)) {
+                k = l;
+            } else {
+                x -= tree_[l];
+                k = l + 1;
+            }
+        }
+        return k - leaves_;
+    }
+
+private:
+    std::size_t n_;
+    std::size_t leaves_;  // power of two >= n_
+    std::vector<T> tree_;  // tree_[1] is the root, tree_[leaves_ + i] = w_i
+};
+
+}  // end namespace util
+
+#endif  // SIQUAN_TOOLS_SUM_TREE_HPP_GUARD
@@ -0,0 +1,79 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief runs many independent tasks on a fixed amount of threads
+ * \details Every thread takes the next task from a shared counter as soon as
+ * its last one is done. For independent tasks of unequal length (e.g. anneals
+ * that stop at different steps) this balances the load like work stealing,
+ * without a queue per thread.
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TOOLS_TASK_POOL_HPP_GUARD
+#define SIQUAN_TOOLS_TASK_POOL_HPP_GUARD
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace util {  // documented in random.hpp
+
+/// \brief calls <tt>f(task, thread)</tt> for every \p task in
+/// <tt>[0, n_tasks)</tt> on \p n_threads threads
+/// \param n_tasks amount of tasks
+/// \param n_threads amount of threads, the calling thread is one of them
+/// \param f callable, tasks running at the same time have a different
+/// \p thread in <tt>[0, n_threads)</tt>
+/// \details The first exception thrown by a task is rethrown after all
+/// threads joined, the tasks that were not started yet are skipped.
+template <typename F>
+void run_tasks(std::size_t const &n_tasks, std::size_t n_threads, F &&f) {
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto work = [&](std::size_t const &thread) {
+        for(std::size_t task; (task = next++) < n_tasks;) {
+            try {
+                f(task, thread);
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(not error) error = std::current_exception();
+                next = n_tasks;
+            }
+        }
+    };
+
+    n_threads = std::max<std::size_t>(1, std::min(n_threads, n_tasks));
+    std::vector<std::thread> pool;
+    for(std::size_t t = 1; t < n_threads; ++t) pool.emplace_back(work, t);
+    work(0);
+    for(auto &t : pool) t.join();
+
+    if(error) std::rethrow_exception(error);
+}
+
+}  // end namespace util
+
+#endif  // SIQUAN_TOOLS_TASK_POOL_HPP_GUARD
@@ -0,0 +1,92 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief An allocator for cache line aligned buffers
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TYPES_ALIGNED_ALLOCATOR_HPP_GUARD
+#define SIQUAN_TYPES_ALIGNED_ALLOCATOR_HPP_GUARD
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace siquan {  // documented in base.hpp
+namespace types {   // documented in interaction.hpp
+
+    /// \brief size of a cache line and of the widest vector register in bytes
+    constexpr std::size_t cache_line = 64;
+
+    /// \brief rounds \p n up to a multiple of \p m
+    constexpr std::size_t round_up(std::size_t const &n,
+                                   std::size_t const &m) {
+        return (n + m - 1) / m * m;
+    }
+
+    /// \brief std compatible allocator that aligns every buffer to \p Align
+    /// bytes
+    /// \tparam T the value type of the container
+    /// \tparam Align the alignment in bytes, needs to be a power of two
+    template <typename T, std::size_t Align = cache_line>
+    struct aligned_allocator {
+        using value_type = T;  ///< needed by std::allocator_traits
+
+        /// \brief needed by std::allocator_traits since \p Align is not a
+        /// type parameter
+        template <typename U>
+        struct rebind {
+            using other = aligned_allocator<U, Align>;  ///< the rebound type
+        };
+
+        /// \brief Constructor
+        aligned_allocator() noexcept = default;
+        /// \brief converting Constructor, the allocator is stateless
+        template <typename U>
+        aligned_allocator(aligned_allocator<U, Align> const &) noexcept {}
+
+        /// \brief allocates space for \p n objects aligned to \p Align bytes
+        T *allocate(std::size_t const n) {
+            void *p = nullptr;
+            if(posix_memalign(&p, Align, round_up(n * sizeof(T), Align)) != 0)
+                throw std::bad_alloc();
+            return static_cast<T *>(p);
+        }
+        /// \brief releases memory obtained by allocate()
+        void deallocate(T *p, std::size_t) noexcept { std::free(p); }
+    };
+
+    /// \brief all aligned_allocator instances are interchangeable
+    template <typename T, typename U, std::size_t Align>
+    bool operator==(aligned_allocator<T, Align> const &,
+                    aligned_allocator<U, Align> const &) noexcept {
+        return true;
+    }
+    /// \brief all aligned_allocator instances are interchangeable
+    template <typename T, typename U, std::size_t Align>
+    bool operator!=(aligned_allocator<T, Align> const &,
+                    aligned_allocator<U, Align> const &) noexcept {
+        return false;
+    }
+
+}  // end namespace types
+}  // end namespace siquan
+
+#endif  // SIQUAN_TYPES_ALIGNED_ALLOCATOR_HPP_GUARD
@@ -0,0 +1,93 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief Number formats for the local energies of the algorithms
+ * \details A type_carrier selects the format with <tt>using energy_type =
+ * ...;</tt> (double if absent):
+ * energy_type | lanes AVX-512 | tolerance
+ * ----        | -----         | -------------
+ * \p double   | 8             | reference
+ * \p float    | 16            | 2^-24 relative rounding per update (drifts)
+ * \p int32_t  | 16            | weights rounded to 2^-20, exact afterwards
+ *
+ * The float energies accumulate rounding errors like a random walk over the
+ * incremental updates. The fixed point format has no drift, but the sum of the
+ * absolute weights of a spin needs to stay below energy_traits::max_local()
+ * (2048 for \p int32_t).
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TYPES_ENERGY_HPP_GUARD
+#define SIQUAN_TYPES_ENERGY_HPP_GUARD
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace siquan {  // documented in base.hpp
+namespace types {   // documented in interaction.hpp
+
+    /// \brief conversions between the double weights and the energy format
+    /// \tparam E a floating point type, used as is
+    template <typename E, bool = std::is_integral<E>::value>
+    struct energy_traits {
+        using sum_type = double;  ///< type of sums over many slices
+        /// \brief converts a weight or an energy
+        static E from_double(double const &w) { return static_cast<E>(w); }
+        /// \brief converts a (sum of) energies back
+        template <typename T>
+        static double to_double(T const &e) {
+            return static_cast<double>(e);
+        }
+        /// \brief largest local energy that can be represented
+        static double max_local() {
+            return std::numeric_limits<double>::infinity();
+        }
+    };
+
+    /// \brief fixed point format with \p digits - 11 fractional bits, i.e.
+    /// 20 for \p int32_t
+    template <typename E>
+    struct energy_traits<E, true> {
+        using sum_type = int64_t;  ///< type of sums over many slices
+        /// \brief value of the unit in the fixed point format
+        static constexpr double scale() {
+            return double(E(1) << (std::numeric_limits<E>::digits - 11));
+        }
+        /// \brief converts a weight or an energy with rounding to nearest
+        static E from_double(double const &w) {
+            return static_cast<E>(std::lround(w * scale()));
+        }
+        /// \brief converts a (sum of) energies back
+        template <typename T>
+        static double to_double(T const &e) {
+            return static_cast<double>(e) * (1 / scale());
+        }
+        /// \brief largest local energy that can be represented
+        static double max_local() {
+            return std::numeric_limits<E>::max() / scale();
+        }
+    };
+
+}  // end namespace types
+}  // end namespace siquan
+
+#endif  // SIQUAN_TYPES_ENERGY_HPP_GUARD
@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief A multi spin coded trotter-line, one word per slice and one bit per
+ * replica
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TYPES_REPLICA_LINE_HPP_GUARD
+#define SIQUAN_TYPES_REPLICA_LINE_HPP_GUARD
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace types {   // documented in interaction.hpp
+
+    /// \brief The trotter-line of one spin for many independent replicas
+    /// \details Word \p ts holds slice \p ts, bit \p r of it belongs to replica
+    /// \p r. Used as <tt>std::vector<ReplicaLine<>></tt> state_type together
+    /// with algo::replica_quantum_anealing.
+    /// \tparam W unsigned word type, its bit count is the amount of replicas
+    template <typename W = uint64_t>
+    class ReplicaLine {
+    public:
+        /*==using declarations===*/
+        using value_type = W;  ///< one slice of all replicas
+        using iterator = typename std::vector<W>::iterator;  ///< slice iterator
+        using const_iterator = typename std::vector<W>::const_iterator;
+        ///< const slice iterator
+
+        /// \brief amount of replicas
+        static constexpr std::size_t n_replica = sizeof(W) * CHAR_BIT;
+
+        /*====con-/destructor====*/
+        /// \brief Constructor
+        /// \param nt amount of trotter slices, all spins start up (0)
+        ReplicaLine(std::size_t const &nt = 0) : words_(nt, 0) {}
+
+        /*===modifying methods===*/
+        /// \brief flips all spins of all replicas
+        void flip() noexcept {
+            for(auto &w : words_) w = ~w;
+        }
+        /// \brief sets all spins of all replicas up (0)
+        void reset() noexcept {
+            for(auto &w : words_) w = 0;
+        }
+        /// \brief access to slice \p ts of all replicas
+        W &operator[](std::size_t const &ts) noexcept { return words_[ts]; }
+        /// \brief begin of the slices
+        iterator begin() noexcept { return words_.begin(); }
+        /// \brief end of the slices
+        iterator end() noexcept { return words_.end(); }
+
+        /*==== const methods ====*/
+        /// \brief access to slice \p ts of all replicas
+        W const &operator[](std::size_t const &ts) const noexcept {
+            return words_[ts];
+        }
+        /// \brief begin of the slices
+        const_iterator begin() const noexcept { return words_.begin(); }
+        /// \brief end of the slices
+        const_iterator end() const noexcept { return words_.end(); }
+        /// \brief amount of trotter slices
+        std::size_t size() const noexcept { return words_.size(); }
+
+    private:
+        std::vector<W> words_;
+    };
+
+    template <typename W>
+    constexpr std::size_t ReplicaLine<W>::n_replica;
+
+}  // end namespace types
+}  // end namespace siquan
+
+#endif  // SIQUAN_TYPES_REPLICA_LINE_HPP_GUARD
@@ -27,6 +27,8 @@
 #include <array>
 #include <bitset>
 #include <climits>
+#include <cstdint>
+#include <stdexcept>
 #include <vector>
 
 namespace siquan {  // documented in base.hpp
@@ -49,48 +51,49 @@ namespace types {   // documented in interaction.hpp
         }
 
         // modifying methods
+        /// \brief fills the line with the bits of the 64 bit words returned
+        /// by \p gen, starting with the lowest slices
+        /// \tparam G callable returning a \p uint64_t
+        template <typename G>
+        void generate(G &&gen) {
+            this->reset();
+            for(size_t ts = 0; ts < NT; ts += 64)
+                (*this) |= (std::bitset<NT>(gen()) << ts);
+        }
 
         // const methods
         /// \cond IMPLEMENTATION_DETAIL_DOC
         class Biterator {
-            using skip_type = uint32_t;
+            using skip_type = uint64_t;
             static constexpr uint8_t skip_size = sizeof(skip_type) * CHAR_BIT;
-            using array_ptr = std::array<skip_type, (NT - 1) / skip_size + 1> *;
+            using array_ptr =
+                std::array<skip_type, (NT - 1) / skip_size + 1> const *;
 
         public:
             // structors
             Biterator(StaticTrotterLine const &data) noexcept
                 : data_(data),
-                  arr_(static_cast<array_ptr>(static_cast<void *>(&data_))),
+                  arr_(static_cast<array_ptr>(
+                      static_cast<void const *>(&data_))),
                   ts_(0),
                   block_(-1),
                   temp_(0) {
-                next_block();
                 ++(*this);
             }
             Biterator(StaticTrotterLine const &data,
                       uint32_t const &ts) noexcept
                 : data_(data), arr_(nullptr), ts_(ts), block_(), temp_() {}
             // modifying methods
-            inline void next_block() noexcept {
-                ++block_;
-                temp_ = (*arr_)[block_];
-                ts_ = block_ * skip_size;
-                // maybe add later __builtin_ctz(32bit) __builtin_ctll(64bit)
-            }
             inline Biterator &operator++() noexcept {
-                while(block_ < arr_->size()) {
-                    while(temp_.any()) {  // check if there are any bits left
-                        if(temp_.test(0)) {
-                            temp_.reset(0);  // delete last bit
-                            return (*this);
-                        }
-                        ++ts_;
-                        temp_ >>= 1;
+                while(temp_ == 0) {  // skip empty blocks
+                    if(++block_ >= arr_->size()) {
+                        ts_ = NT;
+                        return (*this);
                     }
-                    next_block();
+                    temp_ = (*arr_)[block_];
                 }
-                ts_ = NT;
+                ts_ = block_ * skip_size + __builtin_ctzll(temp_);
+                temp_ &= temp_ - 1;  // delete lowest bit
                 return (*this);
             }
             // const methods
@@ -104,10 +107,18 @@ namespace types {   // documented in interaction.hpp
             array_ptr arr_;
             uint32_t ts_;
             uint32_t block_;
-            std::bitset<skip_size> temp_;
+            skip_type temp_;
         };
         /// \endcond
 
+        /// \brief returns the amount of 64 bit words
+        size_t n_words() const noexcept { return (NT + 63) / 64; }
+        /// \brief returns the slices [64 * i, 64 * i + 64) as a word
+        uint64_t word(size_t const &i) const noexcept {
+            return ((*this) >> (64 * i) & std::bitset<NT>(~uint64_t(0)))
+                .to_ullong();
+        }
+
         /// \brief this Bit-iterator iterates from break-point (e.g. 01 or 10)
         /// to break-point
         inline Biterator begin() const noexcept { return Biterator(*this); }
@@ -119,7 +130,7 @@ namespace types {   // documented in interaction.hpp
 
     /// \brief A dynamic trotter-line if N is only known at runtime
     class DynamicTrotterLine {
-        static int constexpr base_size = 32;
+        static int constexpr base_size = 64;
 
     public:
         // structors
@@ -205,6 +216,18 @@ namespace types {   // documented in interaction.hpp
         void flip() {
             for(auto it = data_.begin(); it != data_.end(); ++it) it->flip();
         }
+        /// \brief fills the line with the bits of the 64 bit words returned
+        /// by \p gen, starting with the lowest slices. Bits beyond size() are
+        /// cleared.
+        /// \tparam G callable returning a \p uint64_t
+        template <typename G>
+        void generate(G &&gen) {
+            for(auto it = data_.begin(); it != data_.end(); ++it)
+                *it = std::bitset<base_size>(gen());
+            if(NT % base_size)
+                data_.back() &=
+                    std::bitset<base_size>((1ull << (NT % base_size)) - 1);
+        }
         /// \endcond
 
         /// \brief used to print the content to a stream
@@ -235,32 +258,23 @@ namespace types {   // documented in interaction.hpp
             Biterator(std::vector<std::bitset<base_size>> const &data,
                       uint32_t const &_NT) noexcept
                 : arr_(data), NT_(_NT), ts_(0), block_(-1), temp_(0) {
-                next_block();
                 ++(*this);
             }
             Biterator(std::vector<std::bitset<base_size>> const &data,
                       uint32_t const &_NT, uint32_t const &ts) noexcept
-                : arr_(data), NT_(_NT), ts_(ts) {}
+                : arr_(data), NT_(_NT), ts_(ts), block_(), temp_() {}
             // modifying methods
-            inline void next_block() noexcept {
-                ++block_;
-                temp_ = arr_[block_];
-                ts_ = block_ * base_size;
-                // maybe add later __builtin_ctz(32bit) __builtin_ctll(64bit)
-            }
             inline Biterator &operator++() noexcept {
-                while(block_ < arr_.size()) {
-                    while(temp_.any()) {  // check if there are any bits left
-                        if(temp_.test(0)) {
-                            temp_.reset(0);  // delete last bit
-                            return (*this);
-                        }
-                        ++ts_;
-                        temp_ >>= 1;
+                while(temp_ == 0) {  // skip empty blocks
+                    if(++block_ >= arr_.size()) {
+                        ts_ = NT_;
+                        return (*this);
                     }
-                    next_block();
+                    temp_ = arr_[block_].to_ullong();
                 }
-                ts_ = NT_;
+                ts_ = block_ * base_size + __builtin_ctzll(temp_);
+                temp_ &= temp_ - 1;  // delete lowest bit
+                if(ts_ > NT_) ts_ = NT_;  // padding bits behind the last slice
                 return (*this);
             }
             // const methods
@@ -274,7 +288,7 @@ namespace types {   // documented in interaction.hpp
             size_t const NT_;
             uint32_t ts_;
             uint32_t block_;
-            std::bitset<base_size> temp_;
+            uint64_t temp_;
         };
         /// \endcond
 
@@ -285,6 +299,12 @@ namespace types {   // documented in interaction.hpp
         inline Biterator end() const noexcept {
             return Biterator(data_, NT, NT);
         }
+        /// \brief returns the amount of 64 bit words
+        size_t n_words() const noexcept { return data_.size(); }
+        /// \brief returns the slices [64 * i, 64 * i + 64) as a word
+        uint64_t word(size_t const &i) const noexcept {
+            return data_[i].to_ullong();
+        }
         /// \brief returns the amount of trotter slices§
         size_t const &size() const noexcept { return NT; }
 
@@ -0,0 +1,385 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright 2026, SiQuAn contributors                                         *
+ *                                                                             *
+ * Licensed under the Apache License, Version 2.0 (the "License");             *
+ * you may not use this file except in compliance with the License.            *
+ * You may obtain a copy of the License at                                     *
+ *                                                                             *
+ *   http://www.apache.org/licenses/LICENSE-2.0                                *
+ *                                                                             *
+ * Unless required by applicable law or agreed to in writing, software         *
+ * distributed under the License is distributed on an "AS IS" BASIS,           *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.    *
+ * See the License for the specific language governing permissions and         *
+ * limitations under the License.                                              *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * ** */
+
+/** \file
+ * \brief A trotter state stored as one contiguous bit matrix
+ * \author
+ * Year      |  Name
+ * ----      | -----
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0 */
+
+#ifndef SIQUAN_TYPES_TROTTER_MATRIX_HPP_GUARD
+#define SIQUAN_TYPES_TROTTER_MATRIX_HPP_GUARD
+
+#include "aligned_allocator.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+namespace types {   // documented in interaction.hpp
+
+    class TrotterMatrix;
+
+    /// \brief A trotter-line on 64 bit words that either owns its words or
+    /// is a view on a row of a TrotterMatrix
+    /// \details Has the same interface as DynamicTrotterLine. Copies always
+    /// own their words, assignments write into the (possibly viewed) words.
+    /// Bits behind the last slice are kept at zero.
+    class WordTrotterLine {
+        friend class TrotterMatrix;
+
+    public:
+        using word_type = uint64_t;  ///< the block type
+        static int constexpr base_size = 64;  ///< bits per block
+        /// \brief the word buffer type
+        using buffer_type =
+            std::vector<word_type, aligned_allocator<word_type>>;
+
+        /// \cond IMPLEMENTATION_DETAIL_DOC
+        class reference {
+        public:
+            reference(word_type &word, word_type const &mask) noexcept
+                : word_(word), mask_(mask) {}
+            reference &operator=(bool const &b) noexcept {
+                word_ = b ? (word_ | mask_) : (word_ & ~mask_);
+                return (*this);
+            }
+            reference &operator=(reference const &rhs) noexcept {
+                return (*this) = bool(rhs);
+            }
+            operator bool() const noexcept { return word_ & mask_; }
+
+        private:
+            word_type &word_;
+            word_type const mask_;
+        };
+        /// \endcond
+
+        // structors
+        /// \brief Constructor
+        /// \param nt the amount of trotter slices
+        WordTrotterLine(uint32_t const &nt)
+            : NT(nt),
+              n_words_(words(nt)),
+              own_(stride(nt)),
+              data_(own_.data()) {}
+        /// \brief deep copy, the copy always owns its words
+        WordTrotterLine(WordTrotterLine const &rhs)
+            : NT(rhs.NT),
+              n_words_(rhs.n_words_),
+              own_(rhs.data_, rhs.data_ + stride(rhs.NT)),
+              data_(own_.data()) {}
+        /// \brief steals the words of an owning line, views stay views
+        WordTrotterLine(WordTrotterLine &&rhs) noexcept
+            : NT(rhs.NT),
+              n_words_(rhs.n_words_),
+              own_(std::move(rhs.own_)),
+              data_(own_.empty() ? rhs.data_ : own_.data()) {}
+
+        /// \brief bitset compatible interface, copies the words
+        /// \pre rhs.size() == size()
+        WordTrotterLine &operator=(WordTrotterLine const &rhs) {
+            std::copy(rhs.data_, rhs.data_ + n_words_, data_);
+            return (*this);
+        }
+        // modifying methods
+        /// \brief bitset compatible interface
+        reference operator[](size_t const &index) noexcept {
+            return reference(data_[index / base_size],
+                             word_type(1) << (index % base_size));
+        }
+        /// \brief bitset compatible interface
+        /// \pre rhs.size() == size()
+        WordTrotterLine &operator^=(WordTrotterLine const &rhs) {
+            for(size_t i = 0; i < n_words_; ++i) data_[i] ^= rhs.data_[i];
+            return (*this);
+        }
+        /// \brief bitset compatible interface
+        WordTrotterLine operator^(WordTrotterLine const &rhs) const {
+            WordTrotterLine res(*this);
+            res ^= rhs;
+            return res;
+        }
+        /// \brief bitset compatible interface
+        /// \pre rhs.size() == size()
+        WordTrotterLine &operator&=(WordTrotterLine const &rhs) {
+            for(size_t i = 0; i < n_words_; ++i) data_[i] &= rhs.data_[i];
+            return (*this);
+        }
+        /// \brief bitset compatible interface
+        /// \pre rhs.size() == size()
+        WordTrotterLine &operator|=(WordTrotterLine const &rhs) {
+            for(size_t i = 0; i < n_words_; ++i) data_[i] |= rhs.data_[i];
+            return (*this);
+        }
+        /// \brief bitset compatible interface
+        WordTrotterLine &operator<<=(uint32_t /*copy*/ shift) {
+            if(shift >= base_size) {
+                int32_t big_shift = shift / base_size;
+                for(int32_t i = n_words_ - 1; i >= big_shift; --i)
+                    data_[i] = data_[i - big_shift];
+
+                for(int32_t i = std::min<int32_t>(big_shift, n_words_) - 1;
+                    i >= 0; --i)
+                    data_[i] = 0;
+
+                shift %= base_size;
+            }
+            if(shift) {
+                data_[n_words_ - 1] <<= shift;
+                for(int i = n_words_ - 2; i >= 0; --i) {
+                    data_[i + 1] |= (data_[i] >> (base_size - shift));
+                    data_[i] <<= shift;
+                }
+            }
+            clear_tail_();
+            return (*this);
+        }
+        /// \brief bitset compatible interface
+        void set() {
+            std::fill(data_, data_ + n_words_, ~word_type(0));
+            clear_tail_();
+        }
+        /// \brief bitset compatible interface
+        void reset() { std::fill(data_, data_ + n_words_, word_type(0)); }
+        /// \brief bitset compatible interface
+        void flip(size_t const &index) {
+            data_[index / base_size] ^= word_type(1) << (index % base_size);
+        }
+        /// \brief bitset compatible interface
+        void flip() {
+            for(size_t i = 0; i < n_words_; ++i) data_[i] = ~data_[i];
+            clear_tail_();
+        }
+        /// \brief fills the line with the bits of the 64 bit words returned
+        /// by \p gen, starting with the lowest slices. Bits beyond size() are
+        /// cleared.
+        /// \tparam G callable returning a \p uint64_t
+        template <typename G>
+        void generate(G &&gen) {
+            for(size_t i = 0; i < n_words_; ++i) data_[i] = gen();
+            clear_tail_();
+        }
+        /// \brief raw access to the words
+        word_type *data() noexcept { return data_; }
+
+        // const methods
+        /// \brief bitset compatible interface
+        bool operator[](size_t const &index) const noexcept {
+            return (data_[index / base_size] >> (index % base_size)) & 1;
+        }
+        /// \brief raw access to the words
+        word_type const *data() const noexcept { return data_; }
+        /// \brief returns the amount of used words
+        size_t const &n_words() const noexcept { return n_words_; }
+        /// \brief returns the slices [64 * i, 64 * i + 64) as a word
+        word_type const &word(size_t const &i) const noexcept {
+            return data_[i];
+        }
+        /// \brief returns the amount of trotter slices
+        size_t const &size() const noexcept { return NT; }
+
+        /// \brief used to print the content to a stream
+        /// \tparam S type of stream
+        /// \param os instance of stream \p S
+        template <typename S>
+        void print(S &os) const {
+            // print the same as a bitset would (little endian)
+            for(size_t i = NT; i > 0; --i) os << (*this)[i - 1];
+        }
+
+        /// \cond IMPLEMENTATION_DETAIL_DOC
+        class Biterator {
+        public:
+            // structors
+            Biterator(word_type const *data, size_t const &n_words,
+                      uint32_t const &_NT) noexcept
+                : arr_(data), n_words_(n_words), NT_(_NT), ts_(0), block_(-1),
+                  temp_(0) {
+                ++(*this);
+            }
+            Biterator(uint32_t const &ts) noexcept
+                : arr_(nullptr), n_words_(), NT_(ts), ts_(ts), block_(),
+                  temp_() {}
+            // modifying methods
+            inline Biterator &operator++() noexcept {
+                while(temp_ == 0) {  // skip empty blocks
+                    if(++block_ >= n_words_) {
+                        ts_ = NT_;
+                        return (*this);
+                    }
+                    temp_ = arr_[block_];
+                }
+                ts_ = block_ * base_size + __builtin_ctzll(temp_);
+                temp_ &= temp_ - 1;  // delete lowest bit
+                return (*this);
+            }
+            // const methods
+            inline bool operator!=(Biterator const &rhs) const noexcept {
+                return ts_ != rhs.ts_;
+            }
+            inline uint32_t const &operator*() const noexcept { return ts_; }
+
+        private:
+            word_type const *arr_;
+            size_t n_words_;
+            uint32_t NT_;
+            uint32_t ts_;
+            uint32_t block_;
+            word_type temp_;
+        };
+        /// \endcond
+
+        /// \brief this Bit-iterator iterates from break-point (e.g. 01 or 10)
+        /// to break-point
+        inline Biterator begin() const noexcept {
+            return Biterator(data_, n_words_, NT);
+        }
+        /// \brief see begin()
+        inline Biterator end() const noexcept { return Biterator(NT); }
+
+        /// \brief amount of words a line with \p nt slices uses
+        static constexpr size_t words(size_t const &nt) noexcept {
+            return (nt + base_size - 1) / base_size;
+        }
+        /// \brief amount of words a line with \p nt slices occupies, i.e.
+        /// words(nt) rounded up to whole cache lines
+        static constexpr size_t stride(size_t const &nt) noexcept {
+            return round_up(words(nt), cache_line / sizeof(word_type));
+        }
+
+    private:
+        /// \brief view on the words of a TrotterMatrix
+        WordTrotterLine(word_type *data, uint32_t const &nt) noexcept
+            : NT(nt), n_words_(words(nt)), own_(), data_(data) {}
+
+        void clear_tail_() noexcept {
+            if(NT % base_size)
+                data_[n_words_ - 1] &= (word_type(1) << (NT % base_size)) - 1;
+        }
+
+    private:
+        size_t const NT;
+        size_t const n_words_;
+        buffer_type own_;
+        word_type *data_;
+    };
+
+    /// \brief makes the word trotter-line printable
+    /// \param os
+    /// \param arg is the trotter-line we want to print
+    inline std::ostream &operator<<(std::ostream &os,
+                                    WordTrotterLine const &arg) {
+        arg.print(os);
+        return os;
+    }
+
+    /// \brief The whole trotter state (one line per spin) in one contiguous,
+    /// cache line aligned buffer
+    /// \details Every row starts on a cache line and is padded to whole cache
+    /// lines. The rows are accessed through WordTrotterLine views, s.t. this
+    /// type can replace a \p std::vector<DynamicTrotterLine> as \p state_type.
+    class TrotterMatrix {
+    public:
+        /*==using declarations===*/
+        using value_type = WordTrotterLine;  ///< the row type
+        using word_type = value_type::word_type;  ///< the block type
+        using iterator = std::vector<value_type>::iterator;  ///< row iterator
+        using const_iterator = std::vector<value_type>::const_iterator;
+        ///< const row iterator
+
+        /*====con-/destructor====*/
+        /// \brief Constructor, an empty state
+        TrotterMatrix() : nt_(0), stride_(0), data_(), rows_() {}
+        /// \brief deep copy, the rows view the new buffer
+        TrotterMatrix(TrotterMatrix const &rhs)
+            : nt_(rhs.nt_), stride_(rhs.stride_), data_(rhs.data_), rows_() {
+            link_rows_(rhs.size());
+        }
+        /// \brief the buffer moves, so the row views stay valid
+        TrotterMatrix(TrotterMatrix &&rhs) = default;
+        /// \brief deep copy, the rows view the new buffer
+        TrotterMatrix &operator=(TrotterMatrix const &rhs) {
+            nt_ = rhs.nt_;
+            stride_ = rhs.stride_;
+            data_ = rhs.data_;
+            link_rows_(rhs.size());
+            return (*this);
+        }
+        /// \brief the buffer moves, so the row views stay valid
+        TrotterMatrix &operator=(TrotterMatrix &&rhs) = default;
+
+        /*===modifying methods===*/
+        /// \brief std::vector compatible interface, every row is set to \p def
+        /// \param n the amount of rows (spins)
+        /// \param def the line all rows are initialized to
+        void resize(size_t const &n, value_type const &def) {
+            nt_ = def.size();
+            stride_ = value_type::stride(nt_);
+            data_.assign(n * stride_, word_type(0));
+            link_rows_(n);
+            for(auto &row : rows_) row = def;
+        }
+        /// \brief std::vector compatible interface
+        value_type &operator[](size_t const &i) noexcept { return rows_[i]; }
+        /// \brief std::vector compatible interface
+        iterator begin() noexcept { return rows_.begin(); }
+        /// \brief std::vector compatible interface
+        iterator end() noexcept { return rows_.end(); }
+        /// \brief raw access to the aligned words of all rows
+        word_type *data() noexcept { return data_.data(); }
+
+        /*==== const methods ====*/
+        /// \brief std::vector compatible interface
+        value_type const &operator[](size_t const &i) const noexcept {
+            return rows_[i];
+        }
+        /// \brief std::vector compatible interface
+        const_iterator begin() const noexcept { return rows_.begin(); }
+        /// \brief std::vector compatible interface
+        const_iterator end() const noexcept { return rows_.end(); }
+        /// \brief raw access to the aligned words of all rows
+        word_type const *data() const noexcept { return data_.data(); }
+        /// \brief returns the amount of rows (spins)
+        size_t size() const noexcept { return rows_.size(); }
+        /// \brief returns the amount of trotter slices per row
+        size_t const &nt() const noexcept { return nt_; }
+        /// \brief returns the distance between two rows in words
+        size_t const &stride() const noexcept { return stride_; }
+
+    private:
+        void link_rows_(size_t const &n) {
+            rows_.clear();
+            rows_.reserve(n);
+            for(size_t i = 0; i < n; ++i)
+                rows_.push_back(value_type(data_.data() + i * stride_, nt_));
+        }
+
+    private:
+        size_t nt_;
+        size_t stride_;
+        value_type::buffer_type data_;
+        std::vector<value_type> rows_;
+    };
+
+}  // end namespace types
+}  // end namespace siquan
+
+#endif  // SIQUAN_TYPES_TROTTER_MATRIX_HPP_GUARD
@@ -25,7 +25,10 @@
 #ifndef SIQUAN_TYPES_TYPES_HPP_GUARD
 #define SIQUAN_TYPES_TYPES_HPP_GUARD
 
+#include "energy.hpp"
 #include "interaction.hpp"
+#include "replica_line.hpp"
 #include "trotter_line.hpp"
+#include "trotter_matrix.hpp"
 
 #endif  // SIQUAN_TYPES_TYPES_HPP_GUARD
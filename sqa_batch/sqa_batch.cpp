@@ -0,0 +1,176 @@
+/** ****************************************************************************
+ * \file
+ * \brief runs many seeds of one problem, that is read and preprocessed once
+ * \author
+ * Year      | Name
+ * --------: | :------------
+ * 2026      | SiQuAn contributors
+ * \copyright  Apache License, Version 2.0
+ ******************************************************************************/
+
+#include <siquan/algo/algo.hpp>
+#include <siquan/base.hpp>
+#include <siquan/connect/connect.hpp>
+#include <siquan/helper.hpp>
+#include <siquan/scheduler/scheduler.hpp>
+#include <siquan/state/simple.hpp>
+#include <siquan/state/trotter.hpp>
+#include <siquan/tools/engines.hpp>
+#include <siquan/tools/task_pool.hpp>
+#include <siquan/types/types.hpp>
+
+#include <fsc/ArgParser.hpp>
+#include <fsc/profiler.hpp>
+
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace siquan {  // documented in base.hpp
+
+struct type_carrier {
+    // connect
+    using user_type = uint32_t;
+    using vert_type = uint32_t;
+
+    using weight_type = double;
+    using constr_type = double;
+
+    using size_type = size_t;
+    using vert_vec_type = std::vector<vert_type>;
+
+    using connect_type =
+        siquan::types::connect_type<weight_type, vert_vec_type>;
+    using connect_vec_type = std::vector<connect_type>;
+
+    // state
+    using state_type = siquan::types::TrotterMatrix;
+    using energy_type = double;  // or float, int32_t (fixed point)
+
+    // scheduler
+    using temp_type = double;
+    using magn_type = double;
+
+    // random
+    using rng_type = util::xoshiro256ss;
+};
+// reads and preprocesses the problem once
+using problem_grid_type =
+    compose<type_carrier, connect::basic, connect::read_in_txt, connect::remap,
+            connect::merge_equal>;
+// one anneal per seed, the connections are shared between all of them
+using grid_type =
+    compose<type_carrier, connect::shared,
+
+            scheduler::sim_step, scheduler::piecewise_multi_T,
+            scheduler::piecewise_multi_H,
+
+            state::trotter,
+
+            connect::normalize_weight, algo::simulated_quantum_anealing,
+            connect::unnormalize_weight, algo::analyze_energy_trotter,
+            algo::best_trotter,
+
+            algo::analyze_energy,
+
+            connect::unmap>;
+}  // end namespace siquan
+
+using namespace siquan;
+
+int main(int argc, char* argv[]) {
+    fsc::ArgParserTpl<std::string> ap(argc, argv);
+
+    problem_grid_type::param pp;
+    grid_type::param p;
+
+    std::map<std::string, std::string> m;
+
+    // set some defaults if we don't want to feed cmd args
+    ap.def("file", ap.get(0, "../test/data/frust.txt"));
+    ap.def("seed", "0");
+    ap.def("seeds", "10");
+    ap.def("workers", std::to_string(std::thread::hardware_concurrency()));
+    ap.def("steps", "1000");
+    ap.def("remap", "sorted,fill,0");
+    ap.def("T", "[0.01,0.01]");
+    ap.def("H", "[10,iF,0.01]");
+    ap.def("nt", "100");
+
+    pp.from_map(ap.n_args());
+    p.from_map(ap.n_args());
+
+    auto const seed = fsc::sto<uint32_t>(ap.n_args().at("seed"));
+    auto const seeds = fsc::sto<size_t>(ap.n_args().at("seeds"));
+    auto const workers = fsc::sto<size_t>(ap.n_args().at("workers"));
+
+    fsc::rdtsc_timer t;
+    t.start();
+
+    problem_grid_type pg(pp);
+    pg.init();
+    p.problem = grid_type::extract(pg);
+
+    // run seed + i for all i in [0, seeds)
+    std::vector<double> energy(seeds);
+    std::vector<std::map<std::string, std::string>> res(seeds);
+    util::run_tasks(seeds, workers, [&](size_t const& i, size_t const&) {
+        grid_type::param pi(p);
+        pi.set_seed(seed + uint32_t(i));
+
+        fsc::rdtsc_timer ti;
+        ti.start();
+
+        grid_type g(pi);
+
+        g.init();
+
+        g.update();
+        while(not g.stop()) {
+            g.step();
+            g.advance(1);
+            g.update();
+        }
+        g.finish();
+
+        ti.stop();
+
+        energy[i] = g.energy();
+        g.to_map(res[i]);
+        siquan::to_map(res[i], ti);
+    });
+
+    t.stop();
+
+    pp.to_map(m);
+    p.to_map(m);
+    m["seed"] = std::to_string(seed);
+    m["seeds"] = std::to_string(seeds);
+    m["workers"] = std::to_string(workers);
+    siquan::to_map(m, t);
+
+    size_t best = 0;
+    size_t n_best = 0;
+    for(size_t i = 0; i < seeds; ++i) {
+        m["seed_" + std::to_string(seed + i)] = fsc::to_string(
+            std::map<std::string, std::string>{{"energy", res[i]["energy"]},
+                                               {"state", res[i]["state"]}});
+        if(energy[i] < energy[best]) best = i;
+    }
+    for(size_t i = 0; i < seeds; ++i) n_best += energy[i] == energy[best];
+
+    // best of all seeds
+    if(seeds > 0) {
+        m["best_seed"] = std::to_string(seed + best);
+        m["best_count"] = std::to_string(n_best);
+        m["energy"] = res[best]["energy"];
+        m["state"] = res[best]["state"];
+    }
+
+    for(auto const& a : m) {
+        std::cout << a.first << " " << a.second << std::endl;
+    }
+
+    return 0;
+}
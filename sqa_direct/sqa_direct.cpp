@@ -10,18 +10,22 @@
 
 #include <siquan/algo/algo.hpp>
 #include <siquan/base.hpp>
+#include <siquan/checkpoint.hpp>
 #include <siquan/connect/connect.hpp>
 #include <siquan/helper.hpp>
 #include <siquan/scheduler/scheduler.hpp>
 #include <siquan/state/simple.hpp>
 #include <siquan/state/trotter.hpp>
+#include <siquan/tools/engines.hpp>
 #include <siquan/types/types.hpp>
 
 #include <fsc/ArgParser.hpp>
 #include <fsc/profiler.hpp>
 
+#include <csignal>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace siquan {  // documented in base.hpp
@@ -42,11 +46,15 @@ struct type_carrier {
     using connect_vec_type = std::vector<connect_type>;
 
     // state
-    using state_type = std::vector<siquan::types::DynamicTrotterLine>;
+    using state_type = siquan::types::TrotterMatrix;
+    using energy_type = double;  // or float, int32_t (fixed point)
 
     // scheduler
     using temp_type = double;
     using magn_type = double;
+
+    // random
+    using rng_type = util::xoshiro256ss;
 };
 using grid_type =
     compose<type_carrier, connect::basic, connect::read_in_txt, connect::remap,
@@ -59,7 +67,7 @@ using grid_type =
 
             connect::normalize_weight, algo::simulated_quantum_anealing,
             connect::unnormalize_weight, algo::analyze_energy_trotter,
-            algo::best_trotter,
+            algo::best_ever_trotter, algo::best_trotter,
 
             algo::analyze_energy,
 
@@ -68,6 +76,12 @@ using grid_type =
 
 using namespace siquan;
 
+namespace {
+// set by SIGTERM, the loop writes a checkpoint and stops
+volatile std::sig_atomic_t terminate_requested = 0;
+extern "C" void request_terminate(int) { terminate_requested = 1; }
+}  // end namespace
+
 int main(int argc, char* argv[]) {
     fsc::ArgParserTpl<std::string> ap(argc, argv);
 
@@ -83,8 +97,18 @@ int main(int argc, char* argv[]) {
     ap.def("T", "[0.01,0.01]");
     ap.def("H", "[10,iF,0.01]");
     ap.def("nt", "100");
+    ap.def("checkpoint", "");  // file, empty for none
+    ap.def("checkpoint_every", "0");  // steps, 0 only on SIGTERM
 
     p.from_map(ap.n_args());
+    p.to_map(m);
+
+    auto const cp_every = fsc::sto<size_t>(ap.n_args().at("checkpoint_every"));
+    std::unique_ptr<checkpoint_writer> cp;
+    if(not ap.n_args().at("checkpoint").empty()) {
+        cp.reset(new checkpoint_writer(ap.n_args().at("checkpoint")));
+        std::signal(SIGTERM, request_terminate);
+    }
 
     fsc::rdtsc_timer t;
     t.start();
@@ -93,17 +117,28 @@ int main(int argc, char* argv[]) {
 
     g.init();
 
+    // continue a checkpoint, taken between advance and update
+    std::string data;
+    if(cp and read_file(cp->file(), data)) restore(g, data, m);
+
     g.update();
     while(not g.stop()) {
         g.step();
         g.advance(1);
+        if(cp and (terminate_requested or
+                   (cp_every > 0 and g.counter() % cp_every == 0))) {
+            cp->write(checkpoint(g, m));
+            if(terminate_requested) {
+                cp->wait();
+                return 128 + SIGTERM;
+            }
+        }
         g.update();
     }
     g.finish();
 
     t.stop();
 
-    p.to_map(m);
     siquan::to_map(m, t);
     g.to_map(m);
 
@@ -33,6 +33,7 @@
 #include <siquan/scheduler/scheduler.hpp>
 #include <siquan/state/simple.hpp>
 #include <siquan/state/trotter.hpp>
+#include <siquan/tools/engines.hpp>
 #include <siquan/types/types.hpp>
 
 #include <fsc/ArgParser.hpp>
@@ -60,11 +61,15 @@ struct type_carrier {
     using connect_vec_type = std::vector<connect_type>;
 
     // state
-    using state_type = std::vector<siquan::types::DynamicTrotterLine>;
+    using state_type = siquan::types::TrotterMatrix;
+    using energy_type = double;  // or float, int32_t (fixed point)
 
     // scheduler
     using temp_type = double;
     using magn_type = double;
+
+    // random
+    using rng_type = util::xoshiro256ss;
 };
 
 using grid_type =